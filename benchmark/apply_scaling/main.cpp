@@ -0,0 +1,91 @@
+#include <xdiag/all.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+using namespace xdiag;
+
+// Times repeated applications of an OpSum in "atomic" and "private" mode,
+// both to a single vector and to a block of vectors
+template <class block_t>
+void benchmark(std::string block_type, OpSum const &ops, block_t const &block,
+               int n_reps) {
+  arma::vec v(block.size(), arma::fill::randn);
+  arma::vec w(block.size(), arma::fill::zeros);
+  for (std::string mode : {"atomic", "private"}) {
+    set_apply_mode(block_type, mode);
+    apply(ops, block, v, block, w); // warmup
+    auto t0 = rightnow();
+    for (int i = 0; i < n_reps; ++i) {
+      apply(ops, block, v, block, w);
+    }
+    auto t1 = rightnow();
+    double secs = duration_cast<microseconds>(t1 - t0).count() / 1e6;
+    Log("{} dim: {} mode: {} time per MVM: {:.5f} secs", block_type,
+        block.size(), mode, secs / n_reps);
+
+    // Multiple vectors at once, applied in row-interleaved storage
+    int n_vecs = 8;
+    arma::mat m(block.size(), n_vecs, arma::fill::randn);
+    arma::mat n(block.size(), n_vecs, arma::fill::zeros);
+    t0 = rightnow();
+    for (int i = 0; i < n_reps; ++i) {
+      apply(ops, block, m, block, n);
+    }
+    t1 = rightnow();
+    secs = duration_cast<microseconds>(t1 - t0).count() / 1e6;
+    Log("{} dim: {} mode: {} time per MVM ({} vectors): {:.5f} secs",
+        block_type, block.size(), mode, n_vecs, secs / (n_reps * n_vecs));
+  }
+}
+
+int main() try {
+  int n_threads = 1;
+#ifdef _OPENMP
+  n_threads = omp_get_max_threads();
+#endif
+  Log("Number of threads: {}", n_threads);
+
+  int n_reps = 10;
+
+  // Heisenberg chain
+  {
+    int N = 26;
+    OpSum ops;
+    for (int i = 0; i < N; ++i) {
+      ops += Op("HB", "J", {i, (i + 1) % N});
+    }
+    ops["J"] = 1.0;
+    benchmark("Spinhalf", ops, Spinhalf(N, N / 2), n_reps);
+  }
+
+  // t-J chain
+  {
+    int N = 18;
+    OpSum ops;
+    for (int i = 0; i < N; ++i) {
+      ops += Op("HOP", "T", {i, (i + 1) % N});
+      ops += Op("HB", "J", {i, (i + 1) % N});
+    }
+    ops["T"] = 1.0;
+    ops["J"] = 0.4;
+    benchmark("tJ", ops, tJ(N, N / 2 - 1, N / 2 - 1), n_reps);
+  }
+
+  // Hubbard chain
+  {
+    int N = 14;
+    OpSum ops;
+    for (int i = 0; i < N; ++i) {
+      ops += Op("HOP", "T", {i, (i + 1) % N});
+    }
+    ops["T"] = 1.0;
+    ops["U"] = 4.0;
+    benchmark("Electron", ops, Electron(N, N / 2, N / 2), n_reps);
+  }
+
+  return EXIT_SUCCESS;
+} catch (Error e) {
+  error_trace(e);
+}
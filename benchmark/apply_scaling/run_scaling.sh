@@ -0,0 +1,4 @@
+#!/bin/bash
+for threads in 1 2 4 8 16 32 64; do
+    OMP_NUM_THREADS=$threads ./build/main
+done
@@ -0,0 +1,94 @@
+#include <xdiag/all.hpp>
+#include <xdiag/symmetries/operations/fermi_sign.hpp>
+
+using namespace xdiag;
+
+// Compares the cost of looking up fermi signs from the split tables with
+// evaluating them on the fly and with a dense table over all states, and
+// prints the memory used by the tables
+PermutationGroup cyclic_group(int64_t n_sites) {
+  std::vector<Permutation> perms;
+  for (int64_t sym = 0; sym < n_sites; ++sym) {
+    std::vector<int64_t> pv;
+    for (int64_t site = 0; site < n_sites; ++site) {
+      pv.push_back((site + sym) % n_sites);
+    }
+    perms.push_back(Permutation(pv));
+  }
+  return PermutationGroup(perms);
+}
+
+template <class F>
+double time_per_sign(std::vector<uint64_t> const &states, int64_t n_symmetries,
+                     F &&sign) {
+  int64_t n_negative = 0;
+  auto t0 = rightnow();
+  for (auto state : states) {
+    for (int64_t sym = 0; sym < n_symmetries; ++sym) {
+      n_negative += sign(sym, state);
+    }
+  }
+  auto t1 = rightnow();
+  double nsecs = duration_cast<nanoseconds>(t1 - t0).count();
+  if (n_negative < 0) { // keep the loop from being optimized away
+    Log("{}", n_negative);
+  }
+  return nsecs / (states.size() * n_symmetries);
+}
+
+int main() try {
+  int64_t n_states = 1 << 18;
+
+  for (int64_t n_sites : {16, 20, 24, 28, 32, 40, 48}) {
+    auto group = cyclic_group(n_sites);
+    int64_t n_symmetries = group.n_symmetries();
+    uint64_t mask = ((uint64_t)1 << n_sites) - 1;
+
+    std::vector<uint64_t> states(n_states);
+    uint64_t state = 12345;
+    for (auto &s : states) {
+      state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+      s = (state >> 7) & mask;
+    }
+
+    auto t0 = rightnow();
+    auto split = combinatorics::FermiTableSubsets<uint64_t>(n_sites, group);
+    auto t1 = rightnow();
+    double build = duration_cast<microseconds>(t1 - t0).count() / 1e6;
+    double t_split = time_per_sign(states, n_symmetries,
+                                   [&](int64_t sym, uint64_t s) {
+                                     return split.sign(sym, s);
+                                   });
+    Log("N={} split table:  {:.2f} ns/sign, memory: {} bytes, build: {:.4f} "
+        "secs",
+        n_sites, t_split, split.memory(), build);
+
+    auto work = symmetries::fermi_work(n_sites);
+    double t_fly = time_per_sign(
+        states, n_symmetries, [&](int64_t sym, uint64_t s) {
+          return symmetries::fermi_bool_of_permutation(s, group[sym], work);
+        });
+    Log("N={} on the fly:   {:.2f} ns/sign, memory: 0 bytes", n_sites, t_fly);
+
+    // dense table over all states, as stored previously
+    if (n_sites <= 24) {
+      std::vector<bool> dense(n_symmetries << n_sites);
+      for (int64_t sym = 0; sym < n_symmetries; ++sym) {
+        for (uint64_t s = 0; s < ((uint64_t)1 << n_sites); ++s) {
+          dense[(sym << n_sites) | s] =
+              symmetries::fermi_bool_of_permutation(s, group[sym], work);
+        }
+      }
+      double t_dense = time_per_sign(
+          states, n_symmetries, [&](int64_t sym, uint64_t s) {
+            return dense[(sym << n_sites) | (int64_t)s];
+          });
+      Log("N={} dense table:  {:.2f} ns/sign, memory: {} bytes", n_sites,
+          t_dense, (n_symmetries << n_sites) / 8);
+    }
+  }
+
+  return EXIT_SUCCESS;
+} catch (Error const &e) {
+  error_trace(e);
+}
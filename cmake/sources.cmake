@@ -4,15 +4,20 @@ set(XDIAG_SOURCES
   utils/logger.cpp
   utils/say_hello.cpp
   utils/read_vectors.cpp
+  utils/block_memory.cpp
   bits/bitops.cpp
   
   parallel/omp/omp_utils.cpp  
   algebra/algebra.cpp
   algebra/matrix.cpp
   algebra/apply.cpp
+  algebra/apply_plan.cpp
+  algebra/apply_mode.cpp
+  algebra/sparse_matrix.cpp
 
   io/args.cpp
   io/args_handler.cpp
+  io/basis_cache.cpp
   io/file_toml.cpp
   io/toml/file_toml_handler.cpp
   io/toml/toml_conversion.cpp
@@ -38,6 +43,7 @@ set(XDIAG_SOURCES
   basis/spinhalf/basis_sz.cpp
   basis/spinhalf/basis_no_sz.cpp
   basis/spinhalf/basis_symmetric_sz.cpp
+  basis/spinhalf/basis_symmetric_sz_compact.cpp
   basis/spinhalf/basis_symmetric_no_sz.cpp
   basis/spinhalf/basis_sublattice.cpp
   basis/spinhalf/apply/dispatch_matrix.cpp
@@ -73,10 +79,12 @@ set(XDIAG_SOURCES
   symmetries/group_action/group_action.cpp
   symmetries/group_action/group_action_lookup.cpp
   symmetries/group_action/group_action_sublattice.cpp
+  symmetries/group_action/representative_sublattice.cpp
   symmetries/group_action/sublattice_stability.cpp
 
   operators/coupling.cpp
   operators/op.cpp
+  operators/op_type.cpp
   operators/opsum.cpp
   operators/compiler.cpp
   operators/symmetrize.cpp
@@ -102,6 +110,7 @@ set(XDIAG_SOURCES
   algorithms/gram_schmidt/orthogonalize.cpp
 
   algorithms/norm_estimate.cpp
+  algorithms/memory_estimate.cpp
   algorithms/time_evolution/exp_sym_v.cpp
   algorithms/time_evolution/time_evolution.cpp
   algorithms/time_evolution/pade_matrix_exponential.cpp
@@ -0,0 +1,143 @@
+#include "../catch.hpp"
+
+#include <iostream>
+
+#include "../blocks/electron/testcases_electron.hpp"
+#include "../blocks/spinhalf/testcases_spinhalf.hpp"
+#include "../blocks/tj/testcases_tj.hpp"
+#include <xdiag/algebra/apply.hpp>
+#include <xdiag/algebra/matrix.hpp>
+#include <xdiag/algebra/sparse_matrix.hpp>
+#include <xdiag/utils/close.hpp>
+
+using namespace xdiag;
+
+template <typename coeff_t>
+static arma::Mat<coeff_t> to_dense(CSRMatrix<coeff_t> const &csr) {
+  arma::Mat<coeff_t> mat(csr.n_rows, csr.n_cols, arma::fill::zeros);
+  for (int64_t row = 0; row < csr.n_rows; ++row) {
+    for (int64_t k = csr.row_ptr[row]; k < csr.row_ptr[row + 1]; ++k) {
+      if (k > csr.row_ptr[row]) {
+        REQUIRE(csr.col_idx[k - 1] < csr.col_idx[k]);
+      }
+      mat(row, csr.col_idx[k]) = csr.data[k];
+    }
+  }
+  return mat;
+}
+
+template <class block_t>
+static void test_sparse_matrix_real(OpSum const &ops, block_t const &block) {
+  auto H = matrix(ops, block);
+  auto S = sparse_matrix(ops, block);
+  REQUIRE(S.n_rows == block.size());
+  REQUIRE(S.n_cols == block.size());
+  REQUIRE(close(H, to_dense(S)));
+  REQUIRE(S.memory() <= sparse_matrix_memory(ops, block, block));
+
+  arma::mat m(block.size(), 3, arma::fill::randn);
+  arma::mat n1 = H * m;
+  arma::mat n2(block.size(), 3, arma::fill::zeros);
+  apply(S, m, n2);
+  REQUIRE(close(n1, n2));
+
+  arma::cx_mat mc(block.size(), 2, arma::fill::randn);
+  arma::cx_mat nc1 = H * mc;
+  arma::cx_mat nc2(block.size(), 2, arma::fill::zeros);
+  apply(S, mc, nc2);
+  REQUIRE(close(nc1, nc2));
+}
+
+template <class block_t>
+static void test_sparse_matrix_cplx(OpSum const &ops, block_t const &block) {
+  auto H = matrixC(ops, block);
+  auto S = sparse_matrixC(ops, block);
+  REQUIRE(close(H, to_dense(S)));
+  REQUIRE(S.memory() <= sparse_matrix_memory(ops, block, block, false));
+
+  arma::cx_mat m(block.size(), 3, arma::fill::randn);
+  arma::cx_mat n1 = H * m;
+  arma::cx_mat n2(block.size(), 3, arma::fill::zeros);
+  apply(S, m, n2);
+  REQUIRE(close(n1, n2));
+}
+
+TEST_CASE("sparse_matrix", "[algebra]") {
+  Log("sparse_matrix: spinhalf");
+  for (int N = 2; N <= 6; ++N) {
+    auto ops = testcases::spinhalf::HB_alltoall(N);
+    test_sparse_matrix_real(ops, Spinhalf(N));
+    for (int nup = 0; nup <= N; ++nup) {
+      test_sparse_matrix_real(ops, Spinhalf(N, nup));
+    }
+  }
+
+  Log("sparse_matrix: spinhalf symmetric");
+  {
+    int N = 6;
+    auto ops = testcases::spinhalf::HBchain(N, 1.0, 0.3);
+    auto [group, irreps] = testcases::electron::get_cyclic_group_irreps(N);
+    for (int nup = 0; nup <= N; ++nup) {
+      for (auto irrep : irreps) {
+        auto block = Spinhalf(N, nup, group, irrep);
+        test_sparse_matrix_cplx(ops, block);
+        if (isreal(block)) {
+          test_sparse_matrix_real(ops, block);
+        }
+      }
+    }
+  }
+
+  Log("sparse_matrix: tJ");
+  for (int N = 3; N <= 5; ++N) {
+    auto ops = testcases::tj::tj_alltoall(N);
+    auto opsc = testcases::tj::tj_alltoall_complex(N);
+    for (int nup = 0; nup <= N; ++nup) {
+      for (int ndn = 0; ndn <= N - nup; ++ndn) {
+        auto block = tJ(N, nup, ndn);
+        test_sparse_matrix_real(ops, block);
+        test_sparse_matrix_cplx(opsc, block);
+      }
+    }
+  }
+
+  Log("sparse_matrix: electron");
+  for (int N = 3; N <= 4; ++N) {
+    auto ops = testcases::electron::freefermion_alltoall(N);
+    ops["U"] = 2.3;
+    auto opsc = testcases::electron::freefermion_alltoall_complex_updn(N);
+    for (int nup = 0; nup <= N; ++nup) {
+      for (int ndn = 0; ndn <= N; ++ndn) {
+        auto block = Electron(N, nup, ndn);
+        test_sparse_matrix_real(ops, block);
+        test_sparse_matrix_cplx(opsc, block);
+      }
+    }
+  }
+
+  Log("sparse_matrix: ApplyPlan with memory budget");
+  {
+    int N = 5;
+    auto ops = testcases::tj::tj_alltoall(N);
+    auto block = tJ(N, 2, 2);
+    auto H = matrix(ops, block);
+    arma::vec v(block.size(), arma::fill::randn);
+    arma::vec w1 = H * v;
+
+    set_sparse_memory_budget(1000000000);
+    ApplyPlan plan(ops, block);
+    REQUIRE(plan.sparse_matrix());
+    arma::vec w2(block.size(), arma::fill::zeros);
+    apply(plan, v, w2);
+    REQUIRE(close(w1, w2));
+
+    set_sparse_memory_budget(16);
+    ApplyPlan plan_small(ops, block);
+    REQUIRE(!plan_small.sparse_matrix());
+    arma::vec w3(block.size(), arma::fill::zeros);
+    apply(plan_small, v, w3);
+    REQUIRE(close(w1, w3));
+
+    set_sparse_memory_budget(0);
+  }
+}
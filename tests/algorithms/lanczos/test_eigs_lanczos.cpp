@@ -3,6 +3,7 @@
 #include <iostream>
 
 #include "../../blocks/electron/testcases_electron.hpp"
+#include "../../blocks/spinhalf/testcases_spinhalf.hpp"
 
 #include <xdiag/algebra/algebra.hpp>
 #include <xdiag/algebra/apply.hpp>
@@ -91,3 +92,58 @@ TEST_CASE("eigs_lanczos", "[lanczos]") {
     }
   printf("Done.\n");
 }
+
+TEST_CASE("eigs_lanczos_mixed", "[lanczos]") {
+  using namespace xdiag::testcases;
+
+  printf("eigs_lanczos_mixed real test ...\n");
+  {
+    int n_sites = 6;
+    auto ops = electron::freefermion_alltoall(n_sites);
+    ops["U"] = 5.0;
+    auto block = Electron(n_sites, 3, 3);
+    arma::vec evals_mat;
+    arma::eig_sym(evals_mat, matrix(ops, block));
+
+    // single precision apply agrees with double precision to rounding
+    ApplyPlan plan(ops, block);
+    arma::vec v(block.size(), arma::fill::randn);
+    arma::vec w(block.size(), arma::fill::zeros);
+    apply(plan, v, w);
+    arma::fvec vf = arma::conv_to<arma::fvec>::from(v);
+    arma::fvec wf(block.size(), arma::fill::zeros);
+    apply(plan, vf, wf);
+    REQUIRE(arma::norm(arma::conv_to<arma::vec>::from(wf) - w) <
+            1e-5 * arma::norm(w));
+    REQUIRE(std::abs(dot(block, vf, vf) - dot(block, v, v)) <
+            1e-5 * dot(block, v, v));
+
+    auto res = eigs_lanczos_mixed(ops, block);
+    REQUIRE(res.eigenvectors.isreal());
+    REQUIRE(std::abs(res.eigenvalues(0) - evals_mat(0)) <
+            1e-6 * std::abs(evals_mat(0)));
+    auto gs = res.eigenvectors.col(0);
+    REQUIRE(close(norm(gs), 1.0));
+    REQUIRE(close(inner(ops, gs), res.eigenvalues(0)));
+  }
+  printf("Done.\n");
+
+  printf("eigs_lanczos_mixed cplx test ...\n");
+  {
+    int n_sites = 10;
+    auto ops = spinhalf::HBchain(n_sites, 1.0, 0.3);
+    auto [group, irreps] = electron::get_cyclic_group_irreps(n_sites);
+    auto block = Spinhalf(n_sites, n_sites / 2, group, irreps[1]);
+    arma::vec evals_mat;
+    arma::eig_sym(evals_mat, matrixC(ops, block));
+
+    auto res = eigs_lanczos_mixed(ops, block);
+    REQUIRE(!res.eigenvectors.isreal());
+    REQUIRE(std::abs(res.eigenvalues(0) - evals_mat(0)) <
+            1e-6 * std::abs(evals_mat(0)));
+    auto gs = res.eigenvectors.col(0);
+    REQUIRE(close(norm(gs), 1.0));
+    REQUIRE(close(real(innerC(ops, gs)), res.eigenvalues(0)));
+  }
+  printf("Done.\n");
+}
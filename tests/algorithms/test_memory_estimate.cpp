@@ -0,0 +1,120 @@
+#include "../catch.hpp"
+
+#include "../blocks/electron/testcases_electron.hpp"
+#include <xdiag/algorithms/memory_estimate.hpp>
+#include <xdiag/blocks/blocks.hpp>
+#include <xdiag/common.hpp>
+#include <xdiag/utils/logger.hpp>
+
+using namespace xdiag;
+
+// estimates should be within a factor of two of the memory actually used
+static void check_estimate(int64_t estimate, int64_t actual) {
+  if (actual == 0) {
+    REQUIRE(estimate == 0);
+  } else {
+    double ratio = (double)estimate / (double)actual;
+    REQUIRE(((ratio > 0.5) && (ratio < 2.0)));
+  }
+}
+
+TEST_CASE("memory_estimate", "[algorithms]") try {
+  Log("Testing block memory and memory estimates");
+
+  int64_t n_sites = 14;
+  auto [group, irreps] =
+      testcases::electron::get_cyclic_group_irreps(n_sites);
+  int64_t n_symmetries = group.n_symmetries();
+
+  {
+    auto block = Spinhalf(n_sites);
+    REQUIRE(memory(block).total() == 0);
+    check_estimate(spinhalf_memory_estimate(n_sites).total(), 0);
+    REQUIRE(spinhalf_dim_estimate(n_sites) == block.size());
+  }
+  for (int64_t n_up = 0; n_up <= n_sites; n_up += 7) {
+    auto block = Spinhalf(n_sites, n_up);
+    auto mem = memory(block);
+    REQUIRE(mem.states == block.size() * (int64_t)sizeof(uint32_t));
+    REQUIRE(mem.norms == 0);
+    REQUIRE(mem.group_action == 0);
+    auto est = spinhalf_memory_estimate(n_sites, n_up);
+    REQUIRE(est.states == mem.states);
+    REQUIRE(est.lintables == mem.lintables);
+    REQUIRE(spinhalf_dim_estimate(n_sites, n_up) == block.size());
+  }
+
+  // symmetric blocks, estimates only differ by the dimension approximation
+  for (auto irrep : irreps) {
+    int64_t n_up = n_sites / 2;
+    for (std::string backend : {"lookup", "compact"}) {
+      auto block = Spinhalf(n_sites, n_up, group, irrep, backend);
+      auto mem = memory(block);
+      auto est = spinhalf_memory_estimate(n_sites, n_up, n_symmetries, 0,
+                                          backend);
+      REQUIRE(mem.norms == block.size() * (int64_t)sizeof(double));
+      check_estimate(est.states, mem.states);
+      check_estimate(est.norms, mem.norms);
+      check_estimate(est.indices, mem.indices);
+      REQUIRE(est.lintables == mem.lintables);
+      REQUIRE(est.group_action == mem.group_action);
+      check_estimate(est.total(), mem.total());
+      check_estimate(spinhalf_dim_estimate(n_sites, n_up, n_symmetries),
+                     block.size());
+    }
+    {
+      auto block = Spinhalf(n_sites, group, irrep);
+      auto mem = memory(block);
+      auto est = spinhalf_memory_estimate(n_sites, undefined, n_symmetries);
+      check_estimate(est.total(), mem.total());
+    }
+  }
+
+  n_sites = 8;
+  std::tie(group, irreps) =
+      testcases::electron::get_cyclic_group_irreps(n_sites);
+  n_symmetries = group.n_symmetries();
+  for (auto irrep : irreps) {
+    {
+      auto block = tJ(n_sites, 3, 2, group, irrep);
+      auto mem = memory(block);
+      auto est = tj_memory_estimate(n_sites, 3, 2, n_symmetries);
+      REQUIRE(mem.fermi_tables > 0);
+      REQUIRE(est.lintables == mem.lintables);
+      check_estimate(est.total(), mem.total());
+      check_estimate(tj_dim_estimate(n_sites, 3, 2, n_symmetries),
+                     block.size());
+    }
+    {
+      auto block = Electron(n_sites, 3, 4, group, irrep);
+      auto mem = memory(block);
+      auto est = electron_memory_estimate(n_sites, 3, 4, n_symmetries);
+      REQUIRE(est.lintables == mem.lintables);
+      check_estimate(est.total(), mem.total());
+      check_estimate(electron_dim_estimate(n_sites, 3, 4, n_symmetries),
+                     block.size());
+    }
+  }
+
+  // algorithms
+  auto block = Spinhalf(n_sites, n_sites / 2);
+  int64_t dim = block.size();
+  REQUIRE(matrix_memory_estimate(block) == dim * dim * 8);
+  REQUIRE(matrix_memory_estimate(block, false) == dim * dim * 16);
+  REQUIRE(eigs_lanczos_memory_estimate(block, true, 2) ==
+          eigs_lanczos_memory_estimate(dim, true, 2));
+  REQUIRE(eigs_lanczos_memory_estimate(dim, true, 3) >
+          eigs_lanczos_memory_estimate(dim, true, 1));
+  REQUIRE(time_evolve_memory_estimate(block, 10) >
+          time_evolve_memory_estimate(block, 5));
+
+  // saturation instead of overflow
+  REQUIRE(matrix_memory_estimate(spinhalf_dim_estimate(64)) ==
+          std::numeric_limits<int64_t>::max());
+  REQUIRE_THROWS(spinhalf_memory_estimate(10, 11));
+  REQUIRE_THROWS(tj_memory_estimate(10, 6, 6));
+
+  Log("{}", to_string(memory(Spinhalf(n_sites, 4))));
+} catch (xdiag::Error e) {
+  error_trace(e);
+}
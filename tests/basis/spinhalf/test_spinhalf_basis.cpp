@@ -5,6 +5,7 @@
 #include <iostream>
 #include <xdiag/basis/spinhalf/basis_symmetric_no_sz.hpp>
 #include <xdiag/basis/spinhalf/basis_symmetric_sz.hpp>
+#include <xdiag/basis/spinhalf/basis_symmetric_sz_compact.hpp>
 #include <xdiag/blocks/spinhalf.hpp>
 #include <xdiag/combinatorics/combinations.hpp>
 #include <xdiag/combinatorics/subsets.hpp>
@@ -50,9 +51,8 @@ void test_spinhalf_basis_state(Basis const &basis, bit_t state) {
   }
 }
 
-template <typename bit_t>
-void check_basis_symmetric_sz(
-    basis::spinhalf::BasisSymmetricSz<bit_t> const &basis) {
+template <typename bit_t, class Basis>
+void check_basis_symmetric_sz(Basis const &basis) {
 
   int n_sites = basis.n_sites();
   int n_up = basis.n_up();
@@ -103,6 +103,18 @@ template <class bit_t> void test_basis_symmetric() {
     for (int nup = 3; nup <= 3; ++nup) {
       auto idxng = BasisSymmetricSz<bit_t>(n_sites, nup, perm_group, irrep);
       check_basis_symmetric_sz<bit_t>(idxng);
+
+      auto idxng_compact =
+          BasisSymmetricSzCompact<bit_t>(n_sites, nup, perm_group, irrep);
+      check_basis_symmetric_sz<bit_t>(idxng_compact);
+      REQUIRE(idxng.size() == idxng_compact.size());
+      for (int64_t idx = 0; idx < idxng.size(); ++idx) {
+        REQUIRE(idxng.state(idx) == idxng_compact.state(idx));
+        REQUIRE(idxng.norm(idx) == idxng_compact.norm(idx));
+      }
+      for (auto state : combinatorics::Combinations<bit_t>(n_sites, nup)) {
+        REQUIRE(idxng.index(state) == idxng_compact.index(state));
+      }
     }
   }
 }
@@ -6,6 +6,7 @@
 #include "testcases_electron.hpp"
 #include <xdiag/algebra/algebra.hpp>
 #include <xdiag/algebra/apply.hpp>
+#include <xdiag/algebra/apply_mode.hpp>
 #include <xdiag/algebra/matrix.hpp>
 #include <xdiag/algorithms/sparse_diag.hpp>
 #include <xdiag/utils/close.hpp>
@@ -62,6 +63,17 @@ TEST_CASE("electron_apply", "[electron]") {
         apply(ops, block, m, block, n2);
         REQUIRE(close(n1, n2));
 
+        ApplyPlan plan_diag(ops, block, 1e-12, true);
+        arma::cx_vec w3(block.size(), arma::fill::zeros);
+        apply(plan_diag, v, w3);
+        REQUIRE(close(w1, w3));
+
+        set_apply_mode("Electron", "private");
+        arma::mat n3(block.size(), 5, arma::fill::zeros);
+        apply(ops, block, m, block, n3);
+        set_apply_mode("Electron", "atomic");
+        REQUIRE(close(n1, n3));
+
         // Compute eigenvalues and compare
         arma::vec evals_mat;
         arma::eig_sym(evals_mat, H);
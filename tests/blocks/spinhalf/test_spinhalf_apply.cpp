@@ -5,6 +5,7 @@
 #include "testcases_spinhalf.hpp"
 #include <xdiag/algebra/algebra.hpp>
 #include <xdiag/algebra/apply.hpp>
+#include <xdiag/algebra/apply_mode.hpp>
 #include <xdiag/algebra/matrix.hpp>
 #include <xdiag/algorithms/sparse_diag.hpp>
 #include <xdiag/utils/close.hpp>
@@ -25,6 +26,13 @@ void test_apply(int N, OpSum ops) {
     apply(ops, block, v, block, w2);
     // toc("1 M-V-M");
 
+    // Check whether thread-private outputs give the same result
+    set_apply_mode("Spinhalf", "private");
+    arma::vec w5(block.size(), arma::fill::zeros);
+    apply(ops, block, v, block, w5);
+    set_apply_mode("Spinhalf", "atomic");
+    REQUIRE(close(w1, w5));
+
     arma::vec w3 = H * H * v;
     arma::vec w4(block.size(), arma::fill::zeros);
     apply(ops, block, w2, block, w4);
@@ -54,6 +62,12 @@ void test_apply_mat(int N, OpSum ops) {
     apply(ops, block, v, block, w2);
     // toc("5 column M-M-M");
 
+    set_apply_mode("Spinhalf", "private");
+    arma::mat w5(block.size(), 5, arma::fill::zeros);
+    apply(ops, block, v, block, w5);
+    set_apply_mode("Spinhalf", "atomic");
+    REQUIRE(close(w1, w5));
+
     arma::mat w3 = H * H * v;
     arma::mat w4(block.size(), 5, arma::fill::zeros);
     apply(ops, block, w2, block, w4);
@@ -125,3 +139,40 @@ TEST_CASE("spinhalf_apply", "[spinhalf]") {
     REQUIRE(close(e0, energy));
   }
 }
+
+TEST_CASE("spinhalf_apply_fused", "[spinhalf]") {
+  using namespace xdiag::testcases::spinhalf;
+  Log.out("spinhalf_apply_fused: comparing fused OpSum to single Op apply");
+
+  for (int n_sites = 2; n_sites <= 6; ++n_sites) {
+    OpSum ops;
+    for (int s = 0; s < n_sites; ++s) {
+      int s2 = (s + 1) % n_sites;
+      if (s2 == s) {
+        continue;
+      }
+      ops += Op("EXCHANGE", 0.3 + 0.1 * s, {s, s2});
+      ops += Op("ISING", -0.7 + 0.2 * s, {s, s2});
+      ops += Op("SZ", 0.25 * s, s);
+      ops += Op("S+", 0.1 + 0.05 * s, s);
+      ops += Op("S-", 0.1 + 0.05 * s, s);
+    }
+
+    auto block = Spinhalf(n_sites);
+    arma::vec v(block.size(), arma::fill::randn);
+    arma::vec w1(block.size(), arma::fill::zeros);
+    apply(ops, block, v, block, w1);
+
+    arma::vec w2(block.size(), arma::fill::zeros);
+    for (auto op : ops) {
+      arma::vec w(block.size(), arma::fill::zeros);
+      apply(OpSum({op}), block, v, block, w);
+      w2 += w;
+    }
+    REQUIRE(close(w1, w2));
+
+    auto H = matrix(ops, block);
+    REQUIRE(H.is_hermitian(1e-8));
+    REQUIRE(close(arma::vec(H * v), w1));
+  }
+}
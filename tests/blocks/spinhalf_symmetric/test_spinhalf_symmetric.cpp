@@ -2,6 +2,8 @@
 
 #include <iostream>
 
+#include "../spinhalf/testcases_spinhalf.hpp"
+
 #include <xdiag/algebra/algebra.hpp>
 #include <xdiag/algebra/matrix.hpp>
 #include <xdiag/algebra/apply.hpp>
@@ -111,3 +113,66 @@ TEST_CASE("spinhalf_symmetric", "[spinhalf]") {
   }
   REQUIRE(sum_dim == (int64_t)pow(2, n_sites));
 }
+
+void test_spinhalf_blocks(int64_t n_sites, int64_t nup,
+                          PermutationGroup const &space_group,
+                          std::vector<Representation> const &irreps,
+                          OpSum const &ops) {
+  auto blocks = spinhalf_blocks(n_sites, nup, space_group, irreps);
+  REQUIRE(blocks.size() == irreps.size());
+  for (int64_t k = 0; k < (int64_t)irreps.size(); ++k) {
+    auto block = Spinhalf(n_sites, nup, space_group, irreps[k]);
+    REQUIRE(blocks[k] == block);
+    REQUIRE(blocks[k].size() == block.size());
+    int64_t idx = 0;
+    for (auto pstate : block) {
+      REQUIRE(blocks[k].index(pstate) == idx++);
+    }
+    if (ops.size() > 0) {
+      auto H = matrixC(ops, block);
+      auto H2 = matrixC(ops, blocks[k]);
+      REQUIRE(close(H, H2));
+    }
+  }
+}
+
+TEST_CASE("spinhalf_blocks", "[spinhalf]") {
+  Log.out("spinhalf_blocks: Spinhalf Chain 10");
+  int64_t n_sites = 10;
+  std::vector<Permutation> permutation_array;
+  for (int64_t sym = 0; sym < n_sites; ++sym) {
+    std::vector<int64_t> pv;
+    for (int64_t site = 0; site < n_sites; ++site) {
+      pv.push_back((site + sym) % n_sites);
+    }
+    permutation_array.push_back(Permutation(pv));
+  }
+  auto space_group = PermutationGroup(permutation_array);
+  std::vector<Representation> irreps;
+  for (int64_t k = 0; k < n_sites; ++k) {
+    std::vector<complex> chis;
+    for (int64_t l = 0; l < n_sites; ++l)
+      chis.push_back({std::cos(2 * M_PI * l * k / n_sites),
+                      std::sin(2 * M_PI * l * k / n_sites)});
+    irreps.push_back(Representation(chis));
+  }
+  auto ops = testcases::spinhalf::HBchain(n_sites, 1.0, 0.4);
+  for (int64_t nup = 0; nup <= n_sites; ++nup) {
+    test_spinhalf_blocks(n_sites, nup, space_group, irreps, ops);
+  }
+
+  // irreps with a proper allowed subgroup are built separately
+  Log.out("spinhalf_blocks: Triangular 3x3");
+  n_sites = 9;
+  std::string lfile = XDIAG_DIRECTORY
+      "/misc/data/triangular.9.Jz1Jz2Jx1Jx2D1.sublattices.tsl.lat";
+  space_group = PermutationGroup(xdiag::read_permutations(lfile));
+  irreps.clear();
+  for (std::string name : {"Gamma.D6.A1", "Gamma.D6.B2", "Gamma.D6.E1",
+                           "K.D3.A2", "K.D3.E", "Y.D1.A", "Y.D1.B"}) {
+    irreps.push_back(read_representation(lfile, name));
+  }
+  for (int64_t nup = 0; nup <= n_sites; ++nup) {
+    test_spinhalf_blocks(n_sites, nup, space_group, irreps, OpSum());
+  }
+}
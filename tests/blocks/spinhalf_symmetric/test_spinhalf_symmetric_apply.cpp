@@ -6,6 +6,7 @@
 #include "../spinhalf/testcases_spinhalf.hpp"
 #include <xdiag/algebra/algebra.hpp>
 #include <xdiag/algebra/apply.hpp>
+#include <xdiag/algebra/apply_mode.hpp>
 #include <xdiag/algebra/matrix.hpp>
 #include <xdiag/algorithms/sparse_diag.hpp>
 #include <xdiag/utils/close.hpp>
@@ -36,6 +37,26 @@ void test_spinhalf_symmetric_apply(OpSum ops, PermutationGroup space_group,
         apply(ops, block, m, block, n2);
         REQUIRE(close(n1, n2));
 
+        // Check whether a reused ApplyPlan gives the same result
+        ApplyPlan plan(ops, block);
+        for (int i = 0; i < 2; ++i) {
+          arma::cx_vec w3(block.size(), arma::fill::zeros);
+          apply(plan, v, w3);
+          REQUIRE(close(w1, w3));
+        }
+
+        // Check whether a cached diagonal gives the same result
+        ApplyPlan plan_diag(ops, block, 1e-12, true);
+        arma::cx_vec w4(block.size(), arma::fill::zeros);
+        apply(plan_diag, v, w4);
+        REQUIRE(close(w1, w4));
+
+        // Check whether the Hermitian half-sweep gives the same matrix
+        set_hermitian_half_sweep(false);
+        auto H_full = matrixC(ops, block, block);
+        set_hermitian_half_sweep(true);
+        REQUIRE(close(H, H_full));
+
         // Compute eigenvalues and compare
         arma::vec evals_mat;
         arma::eig_sym(evals_mat, H);
@@ -230,6 +230,98 @@ TEST_CASE("spinhalf_symmetric_matrix", "[spinhalf]") {
       // Log("{} {:.18f} {:.18f}", name, eigs(0), energy);
 
       REQUIRE(std::abs(eigs(0) - energy) < 1e-10);
+
+      // compact indexing yields the same matrix
+      auto spinhalf_compact =
+          Spinhalf(n_sites, n_up, space_group, irrep, "compact");
+      REQUIRE(spinhalf_compact.size() == spinhalf.size());
+      auto H_compact = matrixC(ops, spinhalf_compact, spinhalf_compact);
+      REQUIRE(close(H, H_compact));
+    }
+  }
+}
+
+TEST_CASE("spinhalf_symmetric_spinflip_matrix", "[spinhalf]") {
+
+  // Spin flip sectors of a Heisenberg chain without Sz conservation
+  {
+    Log("spinhalf_symmetric_spinflip_matrix: Heisenberg chain N=8");
+    int64_t n_sites = 8;
+    auto ops = testcases::spinhalf::HBchain(n_sites, 1.0, 0.3);
+    auto [space_group, irreps, multiplicities] =
+        testcases::electron::get_cyclic_group_irreps_mult(n_sites);
+    (void)multiplicities;
+    for (auto const &irrep : irreps) {
+      auto block = Spinhalf(n_sites, space_group, irrep);
+      arma::vec eigs = arma::eig_sym(matrixC(ops, block));
+
+      std::vector<double> eigs_flip;
+      int64_t size_flip = 0;
+      for (int64_t spinflip : {1, -1}) {
+        auto block_flip = Spinhalf(n_sites, space_group, irrep, 0, spinflip);
+        REQUIRE(block_flip.spinflip() == spinflip);
+        REQUIRE(block_flip != block);
+        size_flip += block_flip.size();
+        if (block_flip.size() > 0) {
+          auto H = matrixC(ops, block_flip);
+          REQUIRE(arma::norm(H - H.t()) < 1e-12);
+          arma::vec eigs_sector = arma::eig_sym(H);
+          eigs_flip.insert(eigs_flip.end(), eigs_sector.begin(),
+                           eigs_sector.end());
+        }
+      }
+      REQUIRE(size_flip == block.size());
+      std::sort(eigs_flip.begin(), eigs_flip.end());
+      REQUIRE(close(arma::vec(eigs_flip), eigs));
     }
   }
+
+  // Spin flip sectors at n_up = n_sites / 2, also with sublattice coding
+  {
+    Log("spinhalf_symmetric_spinflip_matrix: Triangular J1J2Jchi N=12");
+    std::string lfile =
+        XDIAG_DIRECTORY "/misc/data/triangular.j1j2jch/"
+                        "triangular.12.j1j2jch.sublattices.fsl.lat";
+
+    auto ops = read_opsum(lfile);
+    ops["J1"] = 1.00;
+    ops["J2"] = 0.15;
+    ops["Jchi"] = -0.09;
+    auto space_group = PermutationGroup(xdiag::read_permutations(lfile));
+
+    int64_t n_sites = 12;
+    int64_t n_up = 6;
+    for (std::string name : {"Gamma.C6.A", "Gamma.C6.E1a", "K.C3.Ea", "M.C2.B",
+                             "X.C1.A"}) {
+      auto irrep = read_representation(lfile, name);
+      auto block = Spinhalf(n_sites, n_up, space_group, irrep);
+      arma::vec eigs = arma::eig_sym(matrixC(ops, block));
+
+      std::vector<double> eigs_flip;
+      int64_t size_flip = 0;
+      for (int64_t spinflip : {1, -1}) {
+        auto block_flip =
+            Spinhalf(n_sites, n_up, space_group, irrep, 0, spinflip);
+        size_flip += block_flip.size();
+        auto H = matrixC(ops, block_flip);
+        REQUIRE(arma::norm(H - H.t()) < 1e-12);
+        arma::vec eigs_sector = arma::eig_sym(H);
+        eigs_flip.insert(eigs_flip.end(), eigs_sector.begin(),
+                         eigs_sector.end());
+
+        auto block_sublat =
+            Spinhalf(n_sites, n_up, space_group, irrep, 4, spinflip);
+        REQUIRE(block_sublat.size() == block_flip.size());
+        REQUIRE(close(matrixC(ops, block_sublat), H));
+      }
+      REQUIRE(size_flip == block.size());
+      std::sort(eigs_flip.begin(), eigs_flip.end());
+      REQUIRE(close(arma::vec(eigs_flip), eigs));
+    }
+
+    // spin flip requires n_up = n_sites / 2
+    auto irrep = read_representation(lfile, "Gamma.C6.A");
+    REQUIRE_THROWS(Spinhalf(n_sites, 5, space_group, irrep, 0, 1));
+    REQUIRE_THROWS(Spinhalf(n_sites, n_up, space_group, irrep, 0, 2));
+  }
 }
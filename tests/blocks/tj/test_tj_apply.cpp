@@ -5,6 +5,7 @@
 #include "testcases_tj.hpp"
 #include <xdiag/algorithms/sparse_diag.hpp>
 #include <xdiag/algebra/apply.hpp>
+#include <xdiag/algebra/apply_mode.hpp>
 #include <xdiag/algebra/matrix.hpp>
 #include <xdiag/utils/close.hpp>
 
@@ -35,6 +36,21 @@ TEST_CASE("tj_apply", "[tj]") {
         apply(ops, block, m, block, n2);
         REQUIRE(close(n1, n2));
 
+        ApplyPlan plan(ops, block);
+        for (int i = 0; i < 2; ++i) {
+          arma::vec w3(block.size(), arma::fill::zeros);
+          apply(plan, v, w3);
+          REQUIRE(close(w1, w3));
+        }
+
+        ApplyPlan plan_diag(ops, block, 1e-12, true);
+        arma::vec w4(block.size(), arma::fill::zeros);
+        apply(plan_diag, v, w4);
+        REQUIRE(close(w1, w4));
+        arma::mat n3(block.size(), 5, arma::fill::zeros);
+        apply(plan_diag, m, n3);
+        REQUIRE(close(n1, n3));
+
         arma::vec evals_mat;
         arma::eig_sym(evals_mat, H);
         double e0_mat = evals_mat(0);
@@ -60,6 +76,21 @@ TEST_CASE("tj_apply", "[tj]") {
         apply(ops, block, v, block, w2);
         REQUIRE(close(w1, w2));
 
+        arma::cx_mat m(block.size(), 4, arma::fill::randn);
+        arma::cx_mat n1 = H * m;
+        arma::cx_mat n2(block.size(), 4, arma::fill::zeros);
+        apply(ops, block, m, block, n2);
+        REQUIRE(close(n1, n2));
+
+        set_apply_mode("tJ", "private");
+        arma::cx_vec w3(block.size(), arma::fill::zeros);
+        apply(ops, block, v, block, w3);
+        arma::cx_mat n3(block.size(), 4, arma::fill::zeros);
+        apply(ops, block, m, block, n3);
+        set_apply_mode("tJ", "atomic");
+        REQUIRE(close(w1, w3));
+        REQUIRE(close(n1, n3));
+
         arma::vec evals_mat;
         arma::eig_sym(evals_mat, H);
 
@@ -201,3 +201,52 @@ TEST_CASE("tj_symmetric_matrix", "[tj]") {
     }
   }
 }
+
+TEST_CASE("tj_symmetric_sublattice", "[tj]") {
+  std::vector<std::tuple<std::string, int64_t, std::vector<std::string>>>
+      lattices = {{"/misc/data/square.8.heisenberg.2sl.lat",
+                   1,
+                   {"Gamma.D4.A1", "Gamma.D4.E", "M.D4.B1", "X.D2.A2"}},
+                  {"/misc/data/square.8.heisenberg.2sl.lat",
+                   2,
+                   {"Gamma.D4.A1", "Gamma.D4.E", "M.D4.B1", "X.D2.A2"}},
+                  {"/misc/data/triangular.9.hop.sublattices.tsl.lat",
+                   3,
+                   {"Gamma.D3.A1", "Gamma.D3.E", "K0.D3.A2", "Y.C1.A"}}};
+
+  for (auto [lat, n_sublat, irrep_names] : lattices) {
+    Log("tj_symmetric_sublattice: {}, n_sublat: {}", lat, n_sublat);
+    std::string lfile = XDIAG_DIRECTORY + lat;
+    auto permutations = xdiag::read_permutations(lfile);
+    auto space_group = PermutationGroup(permutations);
+    int64_t n_sites = space_group.n_sites();
+
+    OpSum ops;
+    for (int64_t s = 0; s < n_sites; ++s) {
+      ops += Op("HOP", "T", {s, (s + 1) % n_sites});
+      ops += Op("TJHB", "J", {s, (s + 3) % n_sites});
+    }
+    ops["T"] = 1.0;
+    ops["J"] = 0.4;
+
+    for (auto name : irrep_names) {
+      auto irrep = read_representation(lfile, name);
+      for (int64_t nup = 0; nup <= n_sites; ++nup) {
+        for (int64_t ndn = 0; ndn <= n_sites - nup; ++ndn) {
+          auto block = tJ(n_sites, nup, ndn, space_group, irrep);
+          auto block_sl = tJ(n_sites, nup, ndn, space_group, irrep, n_sublat);
+          REQUIRE(block.size() == block_sl.size());
+          if ((block.size() == 0) || (block.size() > 500)) {
+            continue;
+          }
+          for (auto pstate : block) {
+            REQUIRE(block.index(pstate) == block_sl.index(pstate));
+          }
+          auto H = matrixC(ops, block);
+          auto H_sl = matrixC(ops, block_sl);
+          REQUIRE(close(H, H_sl));
+        }
+      }
+    }
+  }
+}
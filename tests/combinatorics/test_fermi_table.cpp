@@ -61,5 +61,24 @@ TEST_CASE("fermi_table", "[symmetries]") {
   test_fermi_bool_table<uint32_t>(group);
   test_fermi_bool_table<uint64_t>(group);
 
+  // states beyond 32 bits, where prefix and postfix are split unevenly
+  for (int n_sites : {33, 34}) {
+    Log("chain N={} (random states)", n_sites);
+    auto [group, irreps] =
+        xdiag::testcases::electron::get_cyclic_group_irreps(n_sites);
+    (void)irreps;
+    auto fermi_tbl = combinatorics::FermiTableSubsets<uint64_t>(n_sites, group);
+    uint64_t mask = ((uint64_t)1 << n_sites) - 1;
+    uint64_t state = 12345;
+    for (int i = 0; i < 1000; ++i) {
+      state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+      for (int sym = 0; sym < group.n_symmetries(); ++sym) {
+        REQUIRE(fermi_tbl.sign(sym, state & mask) ==
+                symmetries::fermi_bool_of_permutation(state & mask,
+                                                      group[sym]));
+      }
+    }
+  }
+
   Log("done");
 }
@@ -0,0 +1,55 @@
+#include "../catch.hpp"
+
+#include <filesystem>
+
+#include "../blocks/electron/testcases_electron.hpp"
+#include "../blocks/spinhalf/testcases_spinhalf.hpp"
+
+#include <xdiag/algebra/matrix.hpp>
+#include <xdiag/blocks/spinhalf.hpp>
+#include <xdiag/io/basis_cache.hpp>
+#include <xdiag/utils/close.hpp>
+
+TEST_CASE("basis_cache", "[io]") try {
+  using namespace xdiag;
+  using namespace xdiag::testcases::electron;
+  Log("Test basis_cache");
+
+  std::string directory = XDIAG_DIRECTORY "/misc/data/basis_cache";
+  std::filesystem::remove_all(directory);
+  std::filesystem::create_directories(directory);
+
+  int64_t n_sites = 10;
+  auto ops = testcases::spinhalf::HBchain(n_sites, 1.0, 0.3);
+  auto [group, irreps] = get_cyclic_group_irreps(n_sites);
+  for (int64_t nup = 0; nup <= n_sites; ++nup) {
+    for (auto irrep : irreps) {
+      set_basis_cache_directory("");
+      auto block = Spinhalf(n_sites, nup, group, irrep);
+      auto H = matrixC(ops, block);
+
+      // first construction writes, second construction reads the cache
+      set_basis_cache_directory(directory);
+      auto block_w = Spinhalf(n_sites, nup, group, irrep);
+      auto block_r = Spinhalf(n_sites, nup, group, irrep);
+      REQUIRE(block_w.size() == block.size());
+      REQUIRE(block_r.size() == block.size());
+      int64_t idx = 0;
+      for (auto pstate : block) {
+        REQUIRE(block_r.index(pstate) == idx++);
+      }
+      REQUIRE(close(matrixC(ops, block_w), H));
+      REQUIRE(close(matrixC(ops, block_r), H));
+
+      // cached basis remains valid after the file is gone
+      auto block_c = block_r;
+      std::filesystem::remove_all(directory);
+      std::filesystem::create_directories(directory);
+      REQUIRE(close(matrixC(ops, block_c), H));
+    }
+  }
+  set_basis_cache_directory("");
+  std::filesystem::remove_all(directory);
+} catch (xdiag::Error const &e) {
+  xdiag::error_trace(e);
+}
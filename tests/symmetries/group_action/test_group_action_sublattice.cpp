@@ -5,7 +5,9 @@
 #include <xdiag/combinatorics/combinations.hpp>
 #include <xdiag/combinatorics/subsets.hpp>
 #include <xdiag/symmetries/group_action/group_action.hpp>
+#include <xdiag/symmetries/group_action/group_action_lookup.hpp>
 #include <xdiag/symmetries/group_action/group_action_sublattice.hpp>
+#include <xdiag/symmetries/operations/group_action_operations.hpp>
 #include <xdiag/symmetries/operations/symmetry_operations.hpp>
 
 using namespace xdiag;
@@ -57,6 +59,41 @@ void compare_actions(Action1 &&action1, Action2 &&action2) {
   }
 }
 
+// Compares the sublattice coded representative search including the spin flip
+// to the generic search using a GroupActionLookup with spin flip
+template <class bit_t, class ActionSublattice>
+void compare_actions_spinflip(GroupActionLookup<bit_t> const &action,
+                              ActionSublattice const &action_sl) {
+  int n_sites = action.n_sites();
+  int n_symmetries = action.n_symmetries();
+  REQUIRE(action_sl.n_sites() == n_sites);
+  REQUIRE(action_sl.n_symmetries() == n_symmetries);
+  REQUIRE(action_sl.spinflip());
+
+  for (bit_t bits : combinatorics::Subsets<bit_t>(n_sites)) {
+    for (int sym = 0; sym < n_symmetries; ++sym) {
+      REQUIRE(action.apply(sym, bits) == action_sl.apply(sym, bits));
+      REQUIRE(action_sl.apply(action_sl.inverse(sym),
+                              action_sl.apply(sym, bits)) == bits);
+    }
+
+    bit_t rep = symmetries::representative(bits, action);
+    REQUIRE(action_sl.representative(bits) == rep);
+
+    auto [rep_sl, sym_sl] = action_sl.representative_sym(bits);
+    REQUIRE(rep_sl == rep);
+    REQUIRE(action_sl.apply(sym_sl, bits) == rep);
+
+    auto syms = symmetries::representative_syms(bits, action).second;
+    auto [rep_sl2, syms_sl] = action_sl.representative_syms(bits);
+    REQUIRE(rep_sl2 == rep);
+    REQUIRE(syms_sl.size() == syms.size());
+    for (int64_t sym : syms_sl) {
+      REQUIRE(action_sl.apply(sym, bits) == rep);
+    }
+  }
+}
+
 template <class bit_t> void test_group_action_sublattice() {
 
   {
@@ -82,6 +119,18 @@ template <class bit_t> void test_group_action_sublattice() {
     compare_actions(action, action_sl);
   }
 
+  // Two sublattice with spin flip
+  {
+    Log("GroupActionSublattice: 2 sublattice, spin flip");
+    std::string lfile =
+        XDIAG_DIRECTORY "/misc/data/square.8.heisenberg.2sl.lat";
+    auto permutations = xdiag::read_permutations(lfile);
+    auto perm_group = PermutationGroup(permutations);
+    auto action = GroupActionLookup<bit_t>(perm_group, true);
+    auto action_sl = GroupActionSublattice<bit_t, 2>(perm_group, true);
+    compare_actions_spinflip(action, action_sl);
+  }
+
   // Three sublattice
   {
     Log("GroupActionSublattice: 3 sublattice");
@@ -1,5 +1,18 @@
 #include "../../catch.hpp"
 
+#include <xdiag/combinatorics/combinations.hpp>
+#include <xdiag/combinatorics/combinations_indexing.hpp>
+#include <xdiag/combinatorics/lin_table.hpp>
+#include <xdiag/combinatorics/subsets.hpp>
+#include <xdiag/combinatorics/subsets_indexing.hpp>
+#include <xdiag/symmetries/group_action/group_action_lookup.hpp>
+#include <xdiag/symmetries/operations/representative_list.hpp>
+#include <xdiag/symmetries/permutation_group.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 using namespace xdiag;
 using namespace xdiag::combinatorics;
 using namespace xdiag::symmetries;
@@ -19,38 +32,92 @@ static PermutationGroup cyclic_group(int n_sites) {
   return PermutationGroup(permutation_array);
 }
 
-template <typename bit_t>
-void test_representatives_indices_symmetries_limits_omp(int n_sites) {
+static Representation cyclic_irrep(int n_sites, int k) {
+  std::vector<complex> chis;
+  for (int sym = 0; sym < n_sites; ++sym) {
+    chis.push_back(std::exp(2.0 * pi * 1.0i * (double)(k * sym) / n_sites));
+  }
+  return Representation(chis);
+}
 
-  auto group_action = GroupActionLookup<bit_t>(cyclic_group(n_sites));
+template <typename bit_t, class StatesIndexing>
+static void test_thread_independence(StatesIndexing const &states_indexing,
+                                     GroupActionLookup<bit_t> const &action,
+                                     Representation const &irrep) {
+#ifdef _OPENMP
+  int n_threads = omp_get_max_threads();
+  omp_set_num_threads(1);
+  auto [reps1, idces1, syms1, limits1, norms1] =
+      representatives_indices_symmetries_limits_norms<bit_t>(states_indexing,
+                                                             action, irrep);
+  omp_set_num_threads(3);
+  auto [reps2, idces2, syms2, limits2, norms2] =
+      representatives_indices_symmetries_limits_norms<bit_t>(states_indexing,
+                                                             action, irrep);
+  omp_set_num_threads(n_threads);
 
-  for (int npar = 0; npar <= n_sites; ++npar) {
-    auto lintable = indexing::LinTable<bit_t>(n_sites, npar);
-    auto [reps1, idces1, syms1, limits1] =
-        representatives_indices_symmetries_limits<bit_t>(
-            indexing::CombinationsIndexing<bit_t>(n_sites, npar), group_action);
-    auto [reps2, idces2, syms2, limits2] =
-        representatives_indices_symmetries_limits_omp<bit_t>(
-            indexing::CombinationsIndexing<bit_t>(n_sites, npar), group_action);
+  REQUIRE(reps1 == reps2);
+  REQUIRE(idces1 == idces2);
+  REQUIRE(syms1 == syms2);
+  REQUIRE(limits1 == limits2);
+  REQUIRE(norms1 == norms2);
 
-    REQUIRE(reps1 == reps2);
-    REQUIRE(idces1 == idces2);
-    REQUIRE(syms1 == syms2);
-    REQUIRE(limits1 == limits2);
+  // every state is mapped to its representative
+  for (auto [state, idx] : states_indexing.states_indices()) {
+    int64_t rep_idx = idces2[idx];
+    if (rep_idx != invalid_index) {
+      auto [start, length] = limits2[idx];
+      REQUIRE(length > 0);
+      for (span_size_t i = start; i < start + length; ++i) {
+        REQUIRE(action.apply(syms2[i], state) == reps2[rep_idx]);
+      }
+    }
   }
+#else
+  (void)states_indexing;
+  (void)action;
+  (void)irrep;
+#endif
 }
 
-TEST_CASE("representative_list_omp", "[symmetries]") {
-  using namespace xdiag;
+template <typename bit_t> static void test_representative_list_omp(int n) {
+  auto action = GroupActionLookup<bit_t>(cyclic_group(n));
+  for (int k = 0; k < n; ++k) {
+    auto irrep = cyclic_irrep(n, k);
+    test_thread_independence(SubsetsIndexing<bit_t>(n), action, irrep);
+    for (int npar = 0; npar <= n; ++npar) {
+      test_thread_independence(CombinationsIndexing<bit_t>(n, npar), action,
+                               irrep);
+      test_thread_independence(LinTable<bit_t>(n, npar), action, irrep);
+    }
 
 #ifdef _OPENMP
-  Log("testing representative_list_omp");
-  int max_N = 6;
+    // dns configurations of electron bases
+    int n_threads = omp_get_max_threads();
+    for (int nup = 0; nup <= n; ++nup) {
+      auto [reps_up, idces_up, syms_up, limits_up] =
+          representatives_indices_symmetries_limits<bit_t>(
+              CombinationsIndexing<bit_t>(n, nup), action);
+      for (int ndn = 0; ndn <= n; ++ndn) {
+        omp_set_num_threads(1);
+        auto r1 = electron_dns_norms_limits_offset_size(
+            reps_up, Combinations<bit_t>(n, ndn), action, irrep);
+        omp_set_num_threads(3);
+        auto r2 = electron_dns_norms_limits_offset_size(
+            reps_up, Combinations<bit_t>(n, ndn), action, irrep);
+        REQUIRE(r1 == r2);
+      }
+    }
+    omp_set_num_threads(n_threads);
+#endif
+  }
+}
 
-  for (int n_sites = 0; n_sites <= max_N; ++n_sites) {
-    test_representatives_indices_symmetries_limits_omp<uint16_t>(n_sites);
-    test_representatives_indices_symmetries_limits_omp<uint32_t>(n_sites);
-    test_representatives_indices_symmetries_limits_omp<uint64_t>(n_sites);
+TEST_CASE("representative_list_omp", "[symmetries]") {
+  Log("testing representative_list_omp");
+  for (int n_sites = 1; n_sites <= 8; ++n_sites) {
+    test_representative_list_omp<uint16_t>(n_sites);
+    test_representative_list_omp<uint32_t>(n_sites);
+    test_representative_list_omp<uint64_t>(n_sites);
   }
-#endif
 }
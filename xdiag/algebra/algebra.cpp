@@ -193,6 +193,59 @@ complex dot(Block const &block, arma::cx_vec const &v,
   XDIAG_RETHROW(error);
 }
 
+template <typename vec_t>
+static double_precision_t<vec_t> dot_single(Block const &block,
+                                            arma::Col<vec_t> const &v,
+                                            arma::Col<vec_t> const &w) try {
+  using coeff_t = double_precision_t<vec_t>;
+#ifdef XDIAG_USE_MPI
+  if (isdistributed(block)) {
+    XDIAG_THROW("Single precision vectors not implemented for distributed "
+                "blocks");
+  }
+#else
+  (void)block;
+#endif
+  if (v.n_elem != w.n_elem) {
+    XDIAG_THROW("Vectors of different size in dot product");
+  }
+  vec_t const *x = v.memptr();
+  vec_t const *y = w.memptr();
+  int64_t size = v.n_elem;
+  double re = 0.;
+  double im = 0.;
+#ifdef _OPENMP
+#pragma omp parallel for reduction(+ : re, im) schedule(static)
+#endif
+  for (int64_t i = 0; i < size; ++i) {
+    coeff_t z = xdiag::conj((coeff_t)x[i]) * (coeff_t)y[i];
+    re += xdiag::real(z);
+    im += xdiag::imag(z);
+  }
+  if constexpr (isreal<coeff_t>()) {
+    (void)im;
+    return re;
+  } else {
+    return complex(re, im);
+  }
+} catch (Error const &error) {
+  XDIAG_RETHROW(error);
+  return 0.;
+}
+
+double dot(Block const &block, arma::fvec const &v, arma::fvec const &w) try {
+  return dot_single(block, v, w);
+} catch (Error const &error) {
+  XDIAG_RETHROW(error);
+}
+
+complex dot(Block const &block, arma::cx_fvec const &v,
+            arma::cx_fvec const &w) try {
+  return dot_single(block, v, w);
+} catch (Error const &error) {
+  XDIAG_RETHROW(error);
+}
+
 template <typename coeff_t>
 double norm(Block const &block, arma::Col<coeff_t> const &v) try {
   return std::sqrt(xdiag::real(dot(block, v, v)));
@@ -202,6 +255,8 @@ double norm(Block const &block, arma::Col<coeff_t> const &v) try {
 
 template double norm(Block const &, arma::Col<double> const &);
 template double norm(Block const &, arma::Col<complex> const &);
+template double norm(Block const &, arma::Col<float> const &);
+template double norm(Block const &, arma::Col<std::complex<float>> const &);
 
 template <typename coeff_t>
 double norm1(Block const &block, arma::Col<coeff_t> const &v) try {
@@ -25,6 +25,11 @@ complex innerC(Op const &op, State const &v);
 double dot(Block const &block, arma::vec const &v, arma::vec const &w);
 complex dot(Block const &block, arma::cx_vec const &v, arma::cx_vec const &w);
 
+// single precision vectors, accumulated in double precision
+double dot(Block const &block, arma::fvec const &v, arma::fvec const &w);
+complex dot(Block const &block, arma::cx_fvec const &v,
+            arma::cx_fvec const &w);
+
 template <typename coeff_t>
 double norm(Block const &block, arma::Col<coeff_t> const &v);
 
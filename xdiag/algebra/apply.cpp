@@ -24,27 +24,38 @@ void apply(Op const &op, State const &v, State &w, double precision) try {
 }
 
 void apply(OpSum const &ops, State const &v, State &w, double precision) try {
+  ApplyPlan plan(ops, v.block(), w.block(), precision);
+  apply(plan, v, w);
+} catch (Error const &error) {
+  XDIAG_RETHROW(error);
+}
+
+void apply(ApplyPlan const &plan, State const &v, State &w) try {
+  if ((v.block() != plan.block_in()) || (w.block() != plan.block_out())) {
+    XDIAG_THROW("Blocks of the States do not match the blocks of the "
+                "ApplyPlan");
+  }
   if ((v.n_cols() == 1) && (w.n_cols() == 1)) {
-    if (ops.isreal()) {
+    if (plan.isreal()) {
       if (v.isreal() && w.isreal()) {
         arma::vec vvec = v.vector(0, false);
         arma::vec wvec = w.vector(0, false);
-        apply(ops, v.block(), vvec, w.block(), wvec, precision);
+        apply(plan, vvec, wvec);
       } else if (v.isreal() && !w.isreal()) {
         auto w2 = State(w.block(), true);
         arma::vec vvec = v.vector(0, false);
         arma::vec wvec = w2.vector(0, false);
-        apply(ops, v.block(), vvec, w.block(), wvec, precision);
+        apply(plan, vvec, wvec);
         w = w2;
       } else if (!v.isreal() && w.isreal()) {
         w.make_complex();
         arma::cx_vec vvec = v.vectorC(0, false);
         arma::cx_vec wvec = w.vectorC(0, false);
-        apply(ops, v.block(), vvec, w.block(), wvec, precision);
+        apply(plan, vvec, wvec);
       } else if (!v.isreal() && !w.isreal()) {
         arma::cx_vec vvec = v.vectorC(0, false);
         arma::cx_vec wvec = w.vectorC(0, false);
-        apply(ops, v.block(), vvec, w.block(), wvec, precision);
+        apply(plan, vvec, wvec);
       }
     } else {
       if (v.isreal()) {
@@ -53,35 +64,35 @@ void apply(OpSum const &ops, State const &v, State &w, double precision) try {
         w.make_complex();
         arma::cx_vec vvec = v2.vectorC(0, false);
         arma::cx_vec wvec = w.vectorC(0, false);
-        apply(ops, v.block(), vvec, w.block(), wvec, precision);
+        apply(plan, vvec, wvec);
       } else {
         w.make_complex();
         arma::cx_vec vvec = v.vectorC(0, false);
         arma::cx_vec wvec = w.vectorC(0, false);
-        apply(ops, v.block(), vvec, w.block(), wvec, precision);
+        apply(plan, vvec, wvec);
       }
     }
   } else if (v.n_cols() == w.n_cols()) {
-    if (ops.isreal()) {
+    if (plan.isreal()) {
       if (v.isreal() && w.isreal()) {
         arma::mat vmat = v.matrix(false);
         arma::mat wmat = w.matrix(false);
-        apply(ops, v.block(), vmat, w.block(), wmat, precision);
+        apply(plan, vmat, wmat);
       } } else if (v.isreal() && !w.isreal()) {
         auto w2 = State(w.block(), true);
         arma::mat vmat = v.matrix(false);
         arma::mat wmat = w2.matrix(false);
-        apply(ops, v.block(), vmat, w.block(), wmat, precision);
+        apply(plan, vmat, wmat);
         w = w2;
       } else if (!v.isreal() && w.isreal()) {
         w.make_complex();
         arma::cx_mat vmat = v.matrixC(false);
         arma::cx_mat wmat = w.matrixC(false);
-        apply(ops, v.block(), vmat, w.block(), wmat, precision);
+        apply(plan, vmat, wmat);
       } else if (!v.isreal() && !w.isreal()) {
         arma::cx_mat vmat = v.matrixC(false);
         arma::cx_mat wmat = w.matrixC(false);
-        apply(ops, v.block(), vmat, w.block(), wmat, precision);
+        apply(plan, vmat, wmat);
       } else {
       if (v.isreal()) {
         auto v2 = v;
@@ -89,12 +100,12 @@ void apply(OpSum const &ops, State const &v, State &w, double precision) try {
         w.make_complex();
         arma::cx_mat vmat = v2.matrixC(false);
         arma::cx_mat wmat = w.matrixC(false);
-        apply(ops, v.block(), vmat, w.block(), wmat, precision);
+        apply(plan, vmat, wmat);
       } else {
         w.make_complex();
         arma::cx_vec vvec = v.matrixC(false);
         arma::cx_vec wvec = w.matrixC(false);
-        apply(ops, v.block(), vvec, w.block(), wvec, precision);
+        apply(plan, vvec, wvec);
       } 
     }
   } else {
@@ -302,4 +313,136 @@ template void apply(OpSum const &, Block const &, arma::vec const &,
 template void apply(OpSum const &, Block const &, arma::cx_vec const &,
                     Block const &, arma::cx_vec &, double);
 
+template <typename coeff_t, typename diag_t>
+static void apply_diagonal(arma::Col<diag_t> const &diag,
+                           arma::Mat<coeff_t> const &mat_in,
+                           arma::Mat<coeff_t> &mat_out) {
+  int64_t n_rows = mat_in.n_rows;
+  diag_t const *d = diag.memptr();
+  for (int64_t c = 0; c < (int64_t)mat_in.n_cols; ++c) {
+    coeff_t const *in = mat_in.colptr(c);
+    coeff_t *out = mat_out.colptr(c);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t i = 0; i < n_rows; ++i) {
+      out[i] += (coeff_t)(d[i] * (double_precision_t<coeff_t>)in[i]);
+    }
+  }
+}
+
+template <typename coeff_t, class mat_t>
+void apply_plan(ApplyPlan const &plan, mat_t const &mat_in,
+                mat_t &mat_out) try {
+  // Use stored sparse matrix if available
+  if (auto mat = plan.sparse_matrix()) {
+    apply(*mat, mat_in, mat_out);
+    return;
+  } else if (auto matC = plan.sparse_matrixC()) {
+    if constexpr (iscomplex<coeff_t>()) {
+      apply(*matC, mat_in, mat_out);
+      return;
+    } else {
+      XDIAG_THROW("Cannot apply complex sparse matrix to real vector");
+    }
+  }
+
+  OpSum const &opsc = plan.ops_compiled();
+  std::visit(
+      overload{
+          [&](Spinhalf const &block_in, Spinhalf const &block_out) {
+            mat_out.zeros();
+            auto terms = plan.terms_spinhalf<double_precision_t<coeff_t>>();
+            if (terms) {
+              basis::spinhalf::dispatch_apply(*terms, block_in, mat_in,
+                                              block_out, mat_out);
+            } else {
+              basis::spinhalf::dispatch_apply(opsc, block_in, mat_in,
+                                              block_out, mat_out);
+            }
+          },
+          [&](tJ const &block_in, tJ const &block_out) {
+            mat_out.zeros();
+            basis::tj::dispatch_apply(opsc, block_in, mat_in, block_out,
+                                      mat_out);
+          },
+          [&](Electron const &block_in, Electron const &block_out) {
+            mat_out.zeros();
+            basis::electron::dispatch_apply(opsc, block_in, mat_in, block_out,
+                                            mat_out);
+          },
+#ifdef XDIAG_USE_MPI
+          [&](SpinhalfDistributed const &block_in,
+              SpinhalfDistributed const &block_out) {
+            if constexpr (std::is_same<mat_t, arma::Col<coeff_t>>::value &&
+                          std::is_same<coeff_t,
+                                       double_precision_t<coeff_t>>::value) {
+              mat_out.zeros();
+              basis::spinhalf_distributed::dispatch_apply(
+                  opsc, block_in, mat_in, block_out, mat_out);
+            } else {
+              XDIAG_THROW("Applying an ApplyPlan to multiple columns or "
+                          "single precision vectors not implemented for "
+                          "SpinhalfDistributed blocks");
+            }
+          },
+          [&](tJDistributed const &block_in, tJDistributed const &block_out) {
+            if constexpr (std::is_same<mat_t, arma::Col<coeff_t>>::value &&
+                          std::is_same<coeff_t,
+                                       double_precision_t<coeff_t>>::value) {
+              mat_out.zeros();
+              basis::tj_distributed::dispatch_apply(opsc, block_in, mat_in,
+                                                    block_out, mat_out);
+            } else {
+              XDIAG_THROW("Applying an ApplyPlan to multiple columns or "
+                          "single precision vectors not implemented for "
+                          "tJDistributed blocks");
+            }
+          },
+#endif
+          [&](auto const &block_in, auto const &block_out) {
+            XDIAG_THROW("Invalid combination of blocks in ApplyPlan");
+            (void)block_in;
+            (void)block_out;
+          }},
+      plan.block_in(), plan.block_out());
+
+  if (plan.has_diagonal()) {
+    if (plan.diagonalC().n_elem > 0) {
+      if constexpr (iscomplex<coeff_t>()) {
+        apply_diagonal(plan.diagonalC(), mat_in, mat_out);
+      } else {
+        XDIAG_THROW("Cannot apply complex diagonal to real vector");
+      }
+    } else {
+      apply_diagonal(plan.diagonal(), mat_in, mat_out);
+    }
+  }
+} catch (Error const &error) {
+  XDIAG_RETHROW(error);
+}
+
+template <typename coeff_t>
+void apply(ApplyPlan const &plan, arma::Col<coeff_t> const &vec_in,
+           arma::Col<coeff_t> &vec_out) try {
+  apply_plan<coeff_t>(plan, vec_in, vec_out);
+} catch (Error const &error) {
+  XDIAG_RETHROW(error);
+}
+
+template <typename coeff_t>
+void apply(ApplyPlan const &plan, arma::Mat<coeff_t> const &mat_in,
+           arma::Mat<coeff_t> &mat_out) try {
+  apply_plan<coeff_t>(plan, mat_in, mat_out);
+} catch (Error const &error) {
+  XDIAG_RETHROW(error);
+}
+
+template void apply(ApplyPlan const &, arma::vec const &, arma::vec &);
+template void apply(ApplyPlan const &, arma::cx_vec const &, arma::cx_vec &);
+template void apply(ApplyPlan const &, arma::fvec const &, arma::fvec &);
+template void apply(ApplyPlan const &, arma::cx_fvec const &, arma::cx_fvec &);
+template void apply(ApplyPlan const &, arma::mat const &, arma::mat &);
+template void apply(ApplyPlan const &, arma::cx_mat const &, arma::cx_mat &);
+
 } // namespace xdiag
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <xdiag/algebra/apply_plan.hpp>
 #include <xdiag/extern/armadillo/armadillo>
 #include <xdiag/operators/op.hpp>
 #include <xdiag/operators/opsum.hpp>
@@ -22,6 +23,9 @@ void apply(Op const &op, State const &v, State &w, double precision = 1e-12);
 void apply(OpSum const &ops, State const &v, State &w,
            double precision = 1e-12);
 
+// Apply with a precompiled plan, avoids recompilation on repeated calls
+void apply(ApplyPlan const &plan, State const &v, State &w);
+
 // Internal routines
 template <typename coeff_t>
 void apply(OpSum const &op, Spinhalf const &block_in,
@@ -73,4 +77,14 @@ void apply(OpSum const &ops, Block const &block_in,
            arma::Mat<coeff_t> const &mat_in, Block const &block_out,
            arma::Mat<coeff_t> &mat_out, double precision = 1e-12);
 
+// Vectors may also be stored in single precision (arma::fvec, arma::cx_fvec),
+// matrix elements are then still computed in double precision
+template <typename coeff_t>
+void apply(ApplyPlan const &plan, arma::Col<coeff_t> const &vec_in,
+           arma::Col<coeff_t> &vec_out);
+
+template <typename coeff_t>
+void apply(ApplyPlan const &plan, arma::Mat<coeff_t> const &mat_in,
+           arma::Mat<coeff_t> &mat_out);
+
 } // namespace xdiag
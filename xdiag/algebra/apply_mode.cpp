@@ -0,0 +1,59 @@
+#include "apply_mode.hpp"
+
+namespace xdiag {
+
+static std::string apply_mode_spinhalf = "atomic";
+static std::string apply_mode_tj = "atomic";
+static std::string apply_mode_electron = "atomic";
+static bool hermitian_half_sweep_enabled = true;
+
+static std::string &apply_mode_ref(std::string const &block_type) try {
+  if (block_type == "Spinhalf") {
+    return apply_mode_spinhalf;
+  } else if (block_type == "tJ") {
+    return apply_mode_tj;
+  } else if (block_type == "Electron") {
+    return apply_mode_electron;
+  } else {
+    XDIAG_THROW(fmt::format("Unknown block type \"{}\" for apply mode",
+                            block_type));
+    return apply_mode_spinhalf;
+  }
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+  return apply_mode_spinhalf;
+}
+
+void set_apply_mode(std::string mode) try {
+  set_apply_mode("Spinhalf", mode);
+  set_apply_mode("tJ", mode);
+  set_apply_mode("Electron", mode);
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+}
+
+void set_apply_mode(std::string block_type, std::string mode) try {
+  if ((mode != "atomic") && (mode != "private")) {
+    XDIAG_THROW(fmt::format(
+        "Unknown apply mode \"{}\" (must be \"atomic\" or \"private\")",
+        mode));
+  }
+  apply_mode_ref(block_type) = mode;
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+}
+
+std::string apply_mode(std::string block_type) try {
+  return apply_mode_ref(block_type);
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+  return "";
+}
+
+void set_hermitian_half_sweep(bool enabled) {
+  hermitian_half_sweep_enabled = enabled;
+}
+
+bool hermitian_half_sweep() { return hermitian_half_sweep_enabled; }
+
+} // namespace xdiag
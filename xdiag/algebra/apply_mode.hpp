@@ -0,0 +1,31 @@
+#pragma once
+
+#include <string>
+
+#include <xdiag/common.hpp>
+
+namespace xdiag {
+
+// Sets how OpenMP threads write to the output when applying an OpSum
+//
+// "atomic":  all threads write to the same output using atomic updates
+// "private": every thread accumulates into its own copy of the output, which
+//            are summed up afterwards. No atomics are needed, at the cost of
+//            one additional output vector per thread.
+//
+// The block type can be "Spinhalf", "tJ" or "Electron". If it is omitted, the
+// mode is set for all block types. Without OpenMP the mode has no effect.
+void set_apply_mode(std::string mode);
+void set_apply_mode(std::string block_type, std::string mode);
+std::string apply_mode(std::string block_type);
+
+// Sets whether Hermitian pairs of terms are applied in a single half-sweep on
+// symmetric blocks. If enabled (default), the exchange terms of a spinhalf
+// OpSum are split into a forward part A and its adjoint. Only A is applied,
+// and every matrix element is filled together with its complex conjugate.
+// This halves the number of representative lookups. It is only used if the
+// input and output block agree and A commutes with the symmetry group.
+void set_hermitian_half_sweep(bool enabled);
+bool hermitian_half_sweep();
+
+} // namespace xdiag
@@ -0,0 +1,256 @@
+#include "apply_plan.hpp"
+
+#include <variant>
+
+#include <xdiag/basis/electron/apply/dispatch_apply.hpp>
+#include <xdiag/basis/spinhalf/apply/dispatch_apply.hpp>
+#include <xdiag/basis/tj/apply/dispatch_apply.hpp>
+#include <xdiag/operators/compiler.hpp>
+#include <xdiag/operators/non_branching_op.hpp>
+#include <xdiag/operators/op_type.hpp>
+
+namespace xdiag {
+
+static OpSum compile(OpSum const &ops, Block const &block,
+                     double precision) try {
+  return std::visit(
+      overload{
+          [&](Spinhalf const &b) {
+            return operators::compile_spinhalf(ops, b.n_sites(), precision);
+          },
+          [&](tJ const &b) {
+            return operators::compile_tj(ops, b.n_sites(), precision);
+          },
+          [&](Electron const &b) {
+            return operators::compile_electron(ops, b.n_sites(), precision);
+          },
+#ifdef XDIAG_USE_MPI
+          [&](SpinhalfDistributed const &b) {
+            return operators::compile_spinhalf(ops, b.n_sites(), precision);
+          },
+          [&](tJDistributed const &b) {
+            return operators::compile_tj(ops, b.n_sites(), precision);
+          },
+#endif
+      },
+      block);
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+  return OpSum();
+}
+
+// Compiled Ops which only contribute to the diagonal of the matrix
+static bool is_diagonal_op(Op const &op, Block const &block) try {
+  OpType type = op_type(op);
+  if (std::holds_alternative<Spinhalf>(block)) {
+    if ((type == OpType::ISING) || (type == OpType::SZ)) {
+      return true;
+    } else if (type == OpType::NONBRANCHINGOP) {
+      return operators::NonBranchingOp<uint64_t, complex>(op).is_diagonal();
+    }
+  } else if (std::holds_alternative<tJ>(block)) {
+    return (type == OpType::ISING) || (type == OpType::TJISING) ||
+           (type == OpType::NUMBERUP) || (type == OpType::NUMBERDN);
+  } else if (std::holds_alternative<Electron>(block)) {
+    return (type == OpType::ISING) || (type == OpType::NUMBERUP) ||
+           (type == OpType::NUMBERDN);
+  }
+  return false;
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+  return false;
+}
+
+// Applies the diagonal Ops to a vector of ones to obtain the diagonal
+template <typename coeff_t>
+static arma::Col<coeff_t> compute_diagonal(OpSum const &ops_diag,
+                                           Block const &block) try {
+  arma::Col<coeff_t> ones(size(block), arma::fill::ones);
+  arma::Col<coeff_t> diag(size(block), arma::fill::zeros);
+  std::visit(overload{
+                 [&](Spinhalf const &b) {
+                   basis::spinhalf::dispatch_apply(ops_diag, b, ones, b, diag);
+                 },
+                 [&](tJ const &b) {
+                   basis::tj::dispatch_apply(ops_diag, b, ones, b, diag);
+                 },
+                 [&](Electron const &b) {
+                   basis::electron::dispatch_apply(ops_diag, b, ones, b, diag);
+                 },
+                 [&](auto const &) {
+                   XDIAG_THROW("Cannot cache diagonal for this type of block");
+                 },
+             },
+             block);
+  return diag;
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+  return arma::Col<coeff_t>();
+}
+
+template <typename coeff_t, class block_t>
+static std::shared_ptr<CSRMatrix<coeff_t>>
+sparse_matrix_within_budget(OpSum const &ops, block_t const &block_in,
+                            block_t const &block_out) try {
+  int64_t memory = sparse_matrix_memory_compiled<coeff_t>(ops, block_in,
+                                                          block_out);
+  int64_t budget = sparse_memory_budget();
+  if (memory > budget) {
+    Log(1,
+        "sparse matrix requires {} bytes, exceeding budget of {} bytes, "
+        "using matrix-free apply",
+        memory, budget);
+    return nullptr;
+  }
+  Log(1, "building sparse matrix, estimated memory: {} bytes", memory);
+  return std::make_shared<CSRMatrix<coeff_t>>(
+      sparse_matrix_compiled<coeff_t>(ops, block_in, block_out));
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+  return nullptr;
+}
+
+template <typename coeff_t>
+static std::shared_ptr<CSRMatrix<coeff_t>>
+sparse_matrix_within_budget(OpSum const &ops, Block const &block_in,
+                            Block const &block_out) try {
+  std::shared_ptr<CSRMatrix<coeff_t>> mat;
+  std::visit(
+      overload{
+          [&](Spinhalf const &b_in, Spinhalf const &b_out) {
+            mat = sparse_matrix_within_budget<coeff_t>(ops, b_in, b_out);
+          },
+          [&](tJ const &b_in, tJ const &b_out) {
+            mat = sparse_matrix_within_budget<coeff_t>(ops, b_in, b_out);
+          },
+          [&](Electron const &b_in, Electron const &b_out) {
+            mat = sparse_matrix_within_budget<coeff_t>(ops, b_in, b_out);
+          },
+          [&](auto const &, auto const &) {},
+      },
+      block_in, block_out);
+  return mat;
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+  return nullptr;
+}
+
+template <typename coeff_t>
+static std::shared_ptr<basis::spinhalf::CompiledTermsSpinhalf>
+compile_terms_spinhalf(OpSum const &ops, Spinhalf const &block) try {
+  using namespace basis::spinhalf;
+  if (basis::has_bit_t<uint32_t>(block.basis())) {
+    return std::make_shared<CompiledTermsSpinhalf>(
+        compiled_terms<uint32_t, coeff_t>(ops));
+  } else {
+    return std::make_shared<CompiledTermsSpinhalf>(
+        compiled_terms<uint64_t, coeff_t>(ops));
+  }
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+  return nullptr;
+}
+
+ApplyPlan::ApplyPlan(OpSum const &ops, Block const &block_in,
+                     Block const &block_out, double precision,
+                     bool cache_diagonal) try
+    : ops_(ops), block_in_(block_in), block_out_(block_out),
+      precision_(precision) {
+  if (block_in.index() != block_out.index()) {
+    XDIAG_THROW("Input and output block of an ApplyPlan must be of the same "
+                "type");
+  }
+  ops_compiled_ = compile(ops, block_in, precision);
+
+  // Store the full sparse matrix if it fits into the memory budget
+  if ((sparse_memory_budget() > 0) && !isdistributed(block_in)) {
+    if (ops_compiled_.isreal() && xdiag::isreal(block_in) &&
+        xdiag::isreal(block_out)) {
+      sparse_matrix_ = sparse_matrix_within_budget<double>(
+          ops_compiled_, block_in, block_out);
+    } else {
+      sparse_matrixC_ = sparse_matrix_within_budget<complex>(
+          ops_compiled_, block_in, block_out);
+    }
+    if (sparse_matrix_ || sparse_matrixC_) {
+      return;
+    }
+  }
+
+  // Separate diagonal terms and compute the diagonal once
+  if (cache_diagonal && (block_in == block_out) && !isdistributed(block_in)) {
+    OpSum ops_diag;
+    OpSum ops_offdiag;
+    for (auto const &op : ops_compiled_) {
+      if (is_diagonal_op(op, block_in)) {
+        ops_diag += op;
+      } else {
+        ops_offdiag += op;
+      }
+    }
+    if (ops_compiled_.defined("U")) { // Hubbard U of Electron blocks
+      ops_diag["U"] = ops_compiled_["U"];
+    }
+
+    if ((ops_diag.size() > 0) || ops_diag.defined("U")) {
+      if (ops_diag.isreal()) {
+        diagonal_ = compute_diagonal<double>(ops_diag, block_in);
+      } else {
+        diagonalC_ = compute_diagonal<complex>(ops_diag, block_in);
+      }
+      has_diagonal_ = true;
+      ops_compiled_ = ops_offdiag;
+    }
+  }
+
+  if (auto block = std::get_if<Spinhalf>(&block_in)) {
+    if (ops_compiled_.isreal()) {
+      terms_spinhalf_real_ =
+          compile_terms_spinhalf<double>(ops_compiled_, *block);
+    }
+    terms_spinhalf_cplx_ =
+        compile_terms_spinhalf<complex>(ops_compiled_, *block);
+  }
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+}
+
+ApplyPlan::ApplyPlan(OpSum const &ops, Block const &block, double precision,
+                     bool cache_diagonal) try
+    : ApplyPlan(ops, block, block, precision, cache_diagonal) {
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+}
+
+OpSum const &ApplyPlan::ops() const { return ops_; }
+Block const &ApplyPlan::block_in() const { return block_in_; }
+Block const &ApplyPlan::block_out() const { return block_out_; }
+double ApplyPlan::precision() const { return precision_; }
+bool ApplyPlan::isreal() const { return ops_.isreal(); }
+bool ApplyPlan::has_diagonal() const { return has_diagonal_; }
+arma::vec const &ApplyPlan::diagonal() const { return diagonal_; }
+arma::cx_vec const &ApplyPlan::diagonalC() const { return diagonalC_; }
+CSRMatrix<double> const *ApplyPlan::sparse_matrix() const {
+  return sparse_matrix_.get();
+}
+CSRMatrix<complex> const *ApplyPlan::sparse_matrixC() const {
+  return sparse_matrixC_.get();
+}
+OpSum const &ApplyPlan::ops_compiled() const { return ops_compiled_; }
+
+template <typename coeff_t>
+basis::spinhalf::CompiledTermsSpinhalf const *
+ApplyPlan::terms_spinhalf() const {
+  if constexpr (xdiag::isreal<coeff_t>()) {
+    return terms_spinhalf_real_.get();
+  } else {
+    return terms_spinhalf_cplx_.get();
+  }
+}
+
+template basis::spinhalf::CompiledTermsSpinhalf const *
+ApplyPlan::terms_spinhalf<double>() const;
+template basis::spinhalf::CompiledTermsSpinhalf const *
+ApplyPlan::terms_spinhalf<complex>() const;
+
+} // namespace xdiag
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <memory>
+
+#include <xdiag/algebra/sparse_matrix.hpp>
+#include <xdiag/basis/spinhalf/apply/compiled_terms.hpp>
+#include <xdiag/blocks/blocks.hpp>
+#include <xdiag/common.hpp>
+#include <xdiag/extern/armadillo/armadillo>
+#include <xdiag/operators/opsum.hpp>
+
+namespace xdiag {
+
+// An ApplyPlan stores everything needed to apply an OpSum to vectors of a
+// given pair of blocks which does not depend on the vectors themselves, i.e.
+// the compiled OpSum as well as prebuilt masks, coefficients and lookup
+// tables of the individual terms. It is meant to be constructed once and
+// reused for many applications, e.g. in Lanczos or time evolution.
+//
+// If cache_diagonal is set and the input and output block agree, the
+// diagonal terms (e.g. ISING, SZ, NUMBER, U) are evaluated once and stored as
+// a dense vector. They are then applied as a single elementwise
+// multiply-add instead of being recomputed for every basis state.
+//
+// If a sparse memory budget is set (see set_sparse_memory_budget) and the
+// estimated size of the matrix in CSR format fits into it, the matrix is
+// built once and every application becomes a sparse matrix-vector product.
+// Otherwise, the plan falls back to matrix-free application.
+
+class ApplyPlan {
+public:
+  ApplyPlan() = default;
+  ApplyPlan(OpSum const &ops, Block const &block_in, Block const &block_out,
+            double precision = 1e-12, bool cache_diagonal = false);
+  ApplyPlan(OpSum const &ops, Block const &block, double precision = 1e-12,
+            bool cache_diagonal = false);
+
+  OpSum const &ops() const;
+  Block const &block_in() const;
+  Block const &block_out() const;
+  double precision() const;
+  bool isreal() const;
+
+  // Cached diagonal, empty if not cached or of other type
+  bool has_diagonal() const;
+  arma::vec const &diagonal() const;
+  arma::cx_vec const &diagonalC() const;
+
+  // Stored sparse matrix, nullptr if not within the memory budget
+  CSRMatrix<double> const *sparse_matrix() const;
+  CSRMatrix<complex> const *sparse_matrixC() const;
+
+  // Developer section
+  OpSum const &ops_compiled() const; // without the cached diagonal terms
+
+  // Precompiled spinhalf terms, nullptr if not available
+  template <typename coeff_t>
+  basis::spinhalf::CompiledTermsSpinhalf const *terms_spinhalf() const;
+
+private:
+  OpSum ops_;
+  Block block_in_;
+  Block block_out_;
+  double precision_;
+  OpSum ops_compiled_;
+  bool has_diagonal_ = false;
+  arma::vec diagonal_;
+  arma::cx_vec diagonalC_;
+  std::shared_ptr<CSRMatrix<double>> sparse_matrix_;
+  std::shared_ptr<CSRMatrix<complex>> sparse_matrixC_;
+  std::shared_ptr<basis::spinhalf::CompiledTermsSpinhalf> terms_spinhalf_real_;
+  std::shared_ptr<basis::spinhalf::CompiledTermsSpinhalf> terms_spinhalf_cplx_;
+};
+
+} // namespace xdiag
@@ -1,6 +1,13 @@
 #pragma once
 
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 #include <xdiag/common.hpp>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 namespace xdiag {
 
@@ -16,26 +23,29 @@ constexpr inline void fill_matrix(arma::Mat<coeff_t> &mat, int64_t idx_in,
   fill_matrix(mat.memptr(), idx_in, idx_out, mat.n_rows, val);
 }
 
-template <typename coeff_t>
-inline void fill_apply(coeff_t const *vec_in, coeff_t *vec_out, int64_t idx_in,
+// Vectors may be stored in single precision (vec_t = float or
+// std::complex<float>). The product is then computed in the double precision
+// of the matrix element and only rounded when it is added to the output.
+template <typename coeff_t, typename vec_t = coeff_t>
+inline void fill_apply(vec_t const *vec_in, vec_t *vec_out, int64_t idx_in,
                        int64_t idx_out, coeff_t val) {
+  vec_t x = (vec_t)(val * (coeff_t)vec_in[idx_in]);
   // Atomic update to avoid multiple threads writing to the same address
 #ifdef _OPENMP
-  if constexpr (isreal<coeff_t>()) {
-    coeff_t x = val * vec_in[idx_in];
+  if constexpr (isreal<vec_t>()) {
 #pragma omp atomic update
     vec_out[idx_out] += x;
   } else {
-    complex x = val * vec_in[idx_in];
-    double *r = &reinterpret_cast<double(&)[2]>(vec_out[idx_out])[0];
-    double *i = &reinterpret_cast<double(&)[2]>(vec_out[idx_out])[1];
+    using part_t = real_t<vec_t>;
+    part_t *r = &reinterpret_cast<part_t(&)[2]>(vec_out[idx_out])[0];
+    part_t *i = &reinterpret_cast<part_t(&)[2]>(vec_out[idx_out])[1];
 #pragma omp atomic update
     *r += x.real();
 #pragma omp atomic update
     *i += x.imag();
   }
 #else
-  vec_out[idx_out] += val * vec_in[idx_in];
+  vec_out[idx_out] += x;
 #endif
 }
 
@@ -55,4 +65,217 @@ inline void fill_apply(arma::Mat<coeff_t> const &mat_in,
   }
 }
 
+// Updates the n_vecs contiguous entries belonging to one basis state in
+// row-interleaved (state-major) storage of several vectors
+template <typename coeff_t>
+inline void fill_apply_interleaved(coeff_t const *in, coeff_t *out,
+                                   int64_t n_vecs, coeff_t val) {
+#ifdef _OPENMP
+  for (int64_t c = 0; c < n_vecs; ++c) {
+    fill_apply(in, out, c, c, val);
+  }
+#else
+  for (int64_t c = 0; c < n_vecs; ++c) {
+    out[c] += val * in[c];
+  }
+#endif
+}
+
+// Same as above, but for outputs which are not shared among threads. The
+// update is a plain (vectorizable) multiply-add over all vectors.
+template <typename coeff_t>
+inline void fill_apply_interleaved_private(coeff_t const *in, coeff_t *out,
+                                           int64_t n_vecs, coeff_t val) {
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+  for (int64_t c = 0; c < n_vecs; ++c) {
+    out[c] += val * in[c];
+  }
+}
+
+// Fill for applying to a single vector. Besides the (atomic) update of a
+// single element it offers two cheaper updates for kernels which know that
+// no other thread writes to the same output elements during the current
+// sweep through the basis:
+//
+// exclusive: non-atomic update of a single element
+// axpy:      non-atomic update of n contiguous elements with the same value
+//
+// The vector may be stored in single precision, see fill_apply.
+template <typename coeff_t, typename vec_t = coeff_t> struct FillApply {
+  vec_t const *in;
+  vec_t *out;
+
+  inline void operator()(int64_t idx_in, int64_t idx_out, coeff_t val) const {
+    fill_apply(in, out, idx_in, idx_out, val);
+  }
+  inline void exclusive(int64_t idx_in, int64_t idx_out, coeff_t val) const {
+    out[idx_out] += (vec_t)(val * (coeff_t)in[idx_in]);
+  }
+  inline void axpy(int64_t idx_in, int64_t idx_out, int64_t n,
+                   coeff_t val) const {
+    vec_t const *x = in + idx_in;
+    vec_t *y = out + idx_out;
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for (int64_t k = 0; k < n; ++k) {
+      y[k] += (vec_t)(val * (coeff_t)x[k]);
+    }
+  }
+};
+
+// Same as FillApply for n_vecs vectors in row-interleaved storage
+template <typename coeff_t> struct FillApplyInterleaved {
+  coeff_t const *in;
+  coeff_t *out;
+  int64_t n_vecs;
+
+  inline void operator()(int64_t idx_in, int64_t idx_out, coeff_t val) const {
+    fill_apply_interleaved(in + idx_in * n_vecs, out + idx_out * n_vecs,
+                           n_vecs, val);
+  }
+  inline void exclusive(int64_t idx_in, int64_t idx_out, coeff_t val) const {
+    fill_apply_interleaved_private(in + idx_in * n_vecs,
+                                   out + idx_out * n_vecs, n_vecs, val);
+  }
+  inline void axpy(int64_t idx_in, int64_t idx_out, int64_t n,
+                   coeff_t val) const {
+    fill_apply_interleaved_private(in + idx_in * n_vecs,
+                                   out + idx_out * n_vecs, n * n_vecs, val);
+  }
+};
+
+template <class Fill, class = void>
+struct has_fill_exclusive : std::false_type {};
+template <class Fill>
+struct has_fill_exclusive<Fill, std::void_t<decltype(std::declval<Fill &>()
+                                                         .exclusive(0, 0, 0.))>>
+    : std::true_type {};
+
+template <class Fill, class = void> struct has_fill_axpy : std::false_type {};
+template <class Fill>
+struct has_fill_axpy<
+    Fill, std::void_t<decltype(std::declval<Fill &>().axpy(0, 0, 0, 0.))>>
+    : std::true_type {};
+
+// Fills a matrix element whose output is not written by any other thread
+// during the current sweep. Falls back to the plain fill, e.g. for matrices.
+template <class Fill, typename coeff_t>
+inline void fill_exclusive(Fill &fill, int64_t idx_in, int64_t idx_out,
+                           coeff_t val) {
+  if constexpr (has_fill_exclusive<std::decay_t<Fill>>::value) {
+    fill.exclusive(idx_in, idx_out, val);
+  } else {
+    fill(idx_in, idx_out, val);
+  }
+}
+
+// Fills the n matrix elements (idx_in + k, idx_out + k) with the same value,
+// where the outputs are not written by any other thread during the sweep
+template <class Fill, typename coeff_t>
+inline void fill_axpy(Fill &fill, int64_t idx_in, int64_t idx_out, int64_t n,
+                      coeff_t val) {
+  if constexpr (has_fill_axpy<std::decay_t<Fill>>::value) {
+    fill.axpy(idx_in, idx_out, n, val);
+  } else {
+    for (int64_t k = 0; k < n; ++k) {
+      fill(idx_in + k, idx_out + k, val);
+    }
+  }
+}
+
+// Applies to several vectors at once using row-interleaved (state-major)
+// storage, i.e. the transposes of mat_in and mat_out. All entries belonging
+// to one basis state are then contiguous, such that every matrix element
+// found by the dispatch is applied with one contiguous update of all vectors
+// instead of one strided update per column.
+template <typename coeff_t, class Dispatch>
+void apply_interleaved(arma::Mat<coeff_t> const &mat_in,
+                       arma::Mat<coeff_t> &mat_out, Dispatch &&dispatch) {
+  int64_t n_vecs = mat_in.n_cols;
+  arma::Mat<coeff_t> in_t = mat_in.st();
+  arma::Mat<coeff_t> out_t(n_vecs, mat_out.n_rows, arma::fill::zeros);
+  FillApplyInterleaved<coeff_t> fill{in_t.memptr(), out_t.memptr(), n_vecs};
+  dispatch(fill);
+  mat_out += out_t.st();
+}
+
+#ifdef _OPENMP
+// Fill writing to the output of the calling thread, no atomics are needed
+template <typename coeff_t> struct FillApplyPrivate {
+  coeff_t const *in;
+  coeff_t *const *outs;
+  int64_t n_vecs;
+
+  inline void operator()(int64_t idx_in, int64_t idx_out, coeff_t val) const {
+    fill_apply_interleaved_private(in + idx_in * n_vecs,
+                                   outs[omp_get_thread_num()] +
+                                       idx_out * n_vecs,
+                                   n_vecs, val);
+  }
+  inline void exclusive(int64_t idx_in, int64_t idx_out, coeff_t val) const {
+    (*this)(idx_in, idx_out, val);
+  }
+  inline void axpy(int64_t idx_in, int64_t idx_out, int64_t n,
+                   coeff_t val) const {
+    fill_apply_interleaved_private(in + idx_in * n_vecs,
+                                   outs[omp_get_thread_num()] +
+                                       idx_out * n_vecs,
+                                   n * n_vecs, val);
+  }
+};
+
+// Applies with thread-private output matrices instead of atomic updates. The
+// dispatch function is called with a fill function, every thread accumulates
+// into its own output and the outputs are summed up afterwards. Thread 0
+// writes directly to the shared output. Several vectors are stored
+// row-interleaved as in apply_interleaved.
+template <typename coeff_t, class Dispatch>
+void apply_private(arma::Mat<coeff_t> const &mat_in,
+                   arma::Mat<coeff_t> &mat_out, Dispatch &&dispatch) {
+  int64_t n_vecs = mat_in.n_cols;
+  int64_t n_elem = mat_out.n_elem;
+  int n_threads = omp_get_max_threads();
+
+  arma::Mat<coeff_t> in_t;
+  arma::Mat<coeff_t> out_t;
+  coeff_t const *ptr_in = mat_in.memptr();
+  coeff_t *ptr_out = mat_out.memptr();
+  if (n_vecs > 1) {
+    in_t = mat_in.st();
+    out_t.zeros(n_vecs, mat_out.n_rows);
+    ptr_in = in_t.memptr();
+    ptr_out = out_t.memptr();
+  }
+
+  // Allocate private outputs within threads for first-touch memory placement
+  std::vector<arma::Col<coeff_t>> vecs_private(n_threads);
+  std::vector<coeff_t *> ptrs_out(n_threads, nullptr);
+  ptrs_out[0] = ptr_out;
+#pragma omp parallel num_threads(n_threads)
+  {
+    int t = omp_get_thread_num();
+    if (t > 0) {
+      vecs_private[t].zeros(n_elem);
+      ptrs_out[t] = vecs_private[t].memptr();
+    }
+  }
+
+  FillApplyPrivate<coeff_t> fill{ptr_in, ptrs_out.data(), n_vecs};
+  dispatch(fill);
+
+#pragma omp parallel for schedule(static)
+  for (int64_t i = 0; i < n_elem; ++i) {
+    for (int t = 1; t < n_threads; ++t) {
+      ptr_out[i] += ptrs_out[t][i];
+    }
+  }
+  if (n_vecs > 1) {
+    mat_out += out_t.st();
+  }
+}
+#endif
+
 } // namespace xdiag
@@ -0,0 +1,345 @@
+#include "sparse_matrix.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+
+#include <xdiag/basis/electron/apply/dispatch.hpp>
+#include <xdiag/basis/spinhalf/apply/dispatch.hpp>
+#include <xdiag/basis/tj/apply/dispatch.hpp>
+#include <xdiag/operators/compiler.hpp>
+
+namespace xdiag {
+
+static int64_t sparse_memory_budget_bytes = 0;
+
+void set_sparse_memory_budget(int64_t bytes) try {
+  if (bytes < 0) {
+    XDIAG_THROW("Memory budget for sparse matrices must be non-negative");
+  }
+  sparse_memory_budget_bytes = bytes;
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+}
+
+int64_t sparse_memory_budget() { return sparse_memory_budget_bytes; }
+
+static OpSum compile(OpSum const &ops, Spinhalf const &block,
+                     double precision) {
+  return operators::compile_spinhalf(ops, block.n_sites(), precision);
+}
+static OpSum compile(OpSum const &ops, tJ const &block, double precision) {
+  return operators::compile_tj(ops, block.n_sites(), precision);
+}
+static OpSum compile(OpSum const &ops, Electron const &block,
+                     double precision) {
+  return operators::compile_electron(ops, block.n_sites(), precision);
+}
+
+template <typename coeff_t, class fill_f>
+static void dispatch_sparse(OpSum const &ops, Spinhalf const &block_in,
+                            Spinhalf const &block_out, fill_f &&fill) {
+  basis::spinhalf::dispatch<coeff_t>(ops, block_in, block_out, fill);
+}
+template <typename coeff_t, class fill_f>
+static void dispatch_sparse(OpSum const &ops, tJ const &block_in,
+                            tJ const &block_out, fill_f &&fill) {
+  basis::tj::dispatch<coeff_t>(ops, block_in, block_out, fill);
+}
+template <typename coeff_t, class fill_f>
+static void dispatch_sparse(OpSum const &ops, Electron const &block_in,
+                            Electron const &block_out, fill_f &&fill) {
+  basis::electron::dispatch<coeff_t>(ops, block_in, block_out, fill);
+}
+
+// Number of (possibly duplicate) entries in every row
+template <typename coeff_t, class block_t>
+static std::vector<int64_t> entries_per_row(OpSum const &ops_compiled,
+                                            block_t const &block_in,
+                                            block_t const &block_out) try {
+  std::vector<int64_t> counts;
+  try {
+    counts.resize(block_out.size(), 0);
+  } catch (...) {
+    XDIAG_THROW("Cannot allocate memory for row counts of sparse matrix");
+  }
+  int64_t *counts_ptr = counts.data();
+  auto fill = [counts_ptr](int64_t, int64_t idx_out, coeff_t) {
+#ifdef _OPENMP
+#pragma omp atomic update
+#endif
+    ++counts_ptr[idx_out];
+  };
+  dispatch_sparse<coeff_t>(ops_compiled, block_in, block_out, fill);
+  return counts;
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+  return std::vector<int64_t>();
+}
+
+template <typename coeff_t, class block_t>
+int64_t sparse_matrix_memory_compiled(OpSum const &ops_compiled,
+                                      block_t const &block_in,
+                                      block_t const &block_out) try {
+  auto counts = entries_per_row<coeff_t>(ops_compiled, block_in, block_out);
+  int64_t nnz = std::accumulate(counts.begin(), counts.end(), (int64_t)0);
+  return (int64_t)((counts.size() + 1) * sizeof(int64_t) +
+                   nnz * (sizeof(int64_t) + sizeof(coeff_t)));
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+  return 0;
+}
+
+template <typename coeff_t, class block_t>
+CSRMatrix<coeff_t> sparse_matrix_compiled(OpSum const &ops_compiled,
+                                          block_t const &block_in,
+                                          block_t const &block_out) try {
+  int64_t n_rows = block_out.size();
+  int64_t n_cols = block_in.size();
+
+  // First sweep: count entries to determine the row offsets
+  auto counts = entries_per_row<coeff_t>(ops_compiled, block_in, block_out);
+  std::vector<int64_t> row_ptr(n_rows + 1, 0);
+  std::partial_sum(counts.begin(), counts.end(), row_ptr.begin() + 1);
+  int64_t nnz = row_ptr[n_rows];
+
+  std::vector<int64_t> col_idx;
+  std::vector<coeff_t> data;
+  try {
+    col_idx.resize(nnz);
+    data.resize(nnz);
+  } catch (...) {
+    XDIAG_THROW("Cannot allocate memory for sparse matrix");
+  }
+
+  // Second sweep: record all entries, reusing counts as a write cursor
+  std::copy(row_ptr.begin(), row_ptr.end() - 1, counts.begin());
+  int64_t *cursor = counts.data();
+  auto fill = [&](int64_t idx_in, int64_t idx_out, coeff_t val) {
+    int64_t pos;
+#ifdef _OPENMP
+#pragma omp atomic capture
+#endif
+    pos = cursor[idx_out]++;
+    col_idx[pos] = idx_in;
+    data[pos] = val;
+  };
+  dispatch_sparse<coeff_t>(ops_compiled, block_in, block_out, fill);
+
+  // Sort every row by column, merge duplicate entries and drop zeros
+  std::vector<int64_t> n_entries(n_rows, 0);
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+  {
+    std::vector<std::pair<int64_t, coeff_t>> entries;
+#ifdef _OPENMP
+#pragma omp for schedule(guided)
+#endif
+    for (int64_t row = 0; row < n_rows; ++row) {
+      int64_t start = row_ptr[row];
+      int64_t end = row_ptr[row + 1];
+      entries.clear();
+      for (int64_t k = start; k < end; ++k) {
+        entries.push_back({col_idx[k], data[k]});
+      }
+      std::sort(entries.begin(), entries.end(),
+                [](auto const &a, auto const &b) { return a.first < b.first; });
+
+      int64_t k = start;
+      for (int64_t i = 0; i < (int64_t)entries.size();) {
+        int64_t col = entries[i].first;
+        coeff_t val = 0.;
+        for (; (i < (int64_t)entries.size()) && (entries[i].first == col);
+             ++i) {
+          val += entries[i].second;
+        }
+        if (val != coeff_t(0.)) {
+          col_idx[k] = col;
+          data[k] = val;
+          ++k;
+        }
+      }
+      n_entries[row] = k - start;
+    }
+  }
+
+  // Compact the rows in place, rows only move towards the front
+  int64_t k = 0;
+  std::vector<int64_t> row_ptr_compact(n_rows + 1, 0);
+  for (int64_t row = 0; row < n_rows; ++row) {
+    std::copy(col_idx.begin() + row_ptr[row],
+              col_idx.begin() + row_ptr[row] + n_entries[row],
+              col_idx.begin() + k);
+    std::copy(data.begin() + row_ptr[row],
+              data.begin() + row_ptr[row] + n_entries[row], data.begin() + k);
+    k += n_entries[row];
+    row_ptr_compact[row + 1] = k;
+  }
+  col_idx.resize(k);
+  data.resize(k);
+
+  CSRMatrix<coeff_t> mat;
+  mat.n_rows = n_rows;
+  mat.n_cols = n_cols;
+  mat.row_ptr = std::move(row_ptr_compact);
+  mat.col_idx = std::move(col_idx);
+  mat.data = std::move(data);
+  return mat;
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+  return CSRMatrix<coeff_t>();
+}
+
+template <class block_t>
+CSRMatrix<double> sparse_matrix(OpSum const &ops, block_t const &block_in,
+                                block_t const &block_out,
+                                double precision) try {
+  OpSum opsc = compile(ops, block_in, precision);
+  return sparse_matrix_compiled<double>(opsc, block_in, block_out);
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+  return CSRMatrix<double>();
+}
+
+template <class block_t>
+CSRMatrix<double> sparse_matrix(OpSum const &ops, block_t const &block,
+                                double precision) try {
+  return sparse_matrix(ops, block, block, precision);
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+  return CSRMatrix<double>();
+}
+
+template <class block_t>
+CSRMatrix<complex> sparse_matrixC(OpSum const &ops, block_t const &block_in,
+                                  block_t const &block_out,
+                                  double precision) try {
+  OpSum opsc = compile(ops, block_in, precision);
+  return sparse_matrix_compiled<complex>(opsc, block_in, block_out);
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+  return CSRMatrix<complex>();
+}
+
+template <class block_t>
+CSRMatrix<complex> sparse_matrixC(OpSum const &ops, block_t const &block,
+                                  double precision) try {
+  return sparse_matrixC(ops, block, block, precision);
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+  return CSRMatrix<complex>();
+}
+
+template <class block_t>
+int64_t sparse_matrix_memory(OpSum const &ops, block_t const &block_in,
+                             block_t const &block_out, bool real,
+                             double precision) try {
+  OpSum opsc = compile(ops, block_in, precision);
+  if (real) {
+    return sparse_matrix_memory_compiled<double>(opsc, block_in, block_out);
+  } else {
+    return sparse_matrix_memory_compiled<complex>(opsc, block_in, block_out);
+  }
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+  return 0;
+}
+
+template <typename coeff_t, typename vec_t>
+void apply(CSRMatrix<coeff_t> const &mat, arma::Mat<vec_t> const &mat_in,
+           arma::Mat<vec_t> &mat_out) try {
+  if (((int64_t)mat_in.n_rows != mat.n_cols) ||
+      ((int64_t)mat_out.n_rows != mat.n_rows) ||
+      (mat_in.n_cols != mat_out.n_cols)) {
+    XDIAG_THROW("Dimensions of sparse matrix and input/output do not match");
+  }
+  int64_t const *row_ptr = mat.row_ptr.data();
+  int64_t const *col_idx = mat.col_idx.data();
+  coeff_t const *data = mat.data.data();
+
+  // Single precision vectors are accumulated in double precision
+  using acc_t = double_precision_t<vec_t>;
+  int64_t n_vecs = mat_in.n_cols;
+  if (n_vecs == 1) {
+    vec_t const *in = mat_in.memptr();
+    vec_t *out = mat_out.memptr();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(guided)
+#endif
+    for (int64_t row = 0; row < mat.n_rows; ++row) {
+      acc_t sum = 0.;
+      for (int64_t k = row_ptr[row]; k < row_ptr[row + 1]; ++k) {
+        sum += data[k] * (acc_t)in[col_idx[k]];
+      }
+      out[row] = (vec_t)sum;
+    }
+  } else {
+    // Row-interleaved storage, the matrix is traversed only once
+    arma::Mat<vec_t> in_t = mat_in.st();
+    arma::Mat<vec_t> out_t(n_vecs, mat.n_rows);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(guided)
+#endif
+    for (int64_t row = 0; row < mat.n_rows; ++row) {
+      vec_t *out = out_t.colptr(row);
+      std::fill(out, out + n_vecs, vec_t(0.));
+      for (int64_t k = row_ptr[row]; k < row_ptr[row + 1]; ++k) {
+        vec_t const *in = in_t.colptr(col_idx[k]);
+        coeff_t val = data[k];
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+        for (int64_t c = 0; c < n_vecs; ++c) {
+          out[c] += (vec_t)(val * (acc_t)in[c]);
+        }
+      }
+    }
+    mat_out = out_t.st();
+  }
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+}
+
+template void apply(CSRMatrix<double> const &, arma::Mat<double> const &,
+                    arma::Mat<double> &);
+template void apply(CSRMatrix<double> const &, arma::Mat<complex> const &,
+                    arma::Mat<complex> &);
+template void apply(CSRMatrix<complex> const &, arma::Mat<complex> const &,
+                    arma::Mat<complex> &);
+template void apply(CSRMatrix<double> const &, arma::Mat<float> const &,
+                    arma::Mat<float> &);
+template void apply(CSRMatrix<double> const &,
+                    arma::Mat<std::complex<float>> const &,
+                    arma::Mat<std::complex<float>> &);
+template void apply(CSRMatrix<complex> const &,
+                    arma::Mat<std::complex<float>> const &,
+                    arma::Mat<std::complex<float>> &);
+
+#define INSTANTIATE_SPARSE_MATRIX(BLOCK)                                       \
+  template CSRMatrix<double> sparse_matrix(OpSum const &, BLOCK const &,       \
+                                           BLOCK const &, double);             \
+  template CSRMatrix<double> sparse_matrix(OpSum const &, BLOCK const &,       \
+                                           double);                            \
+  template CSRMatrix<complex> sparse_matrixC(OpSum const &, BLOCK const &,     \
+                                             BLOCK const &, double);           \
+  template CSRMatrix<complex> sparse_matrixC(OpSum const &, BLOCK const &,     \
+                                             double);                          \
+  template int64_t sparse_matrix_memory(OpSum const &, BLOCK const &,          \
+                                        BLOCK const &, bool, double);          \
+  template CSRMatrix<double> sparse_matrix_compiled<double>(                   \
+      OpSum const &, BLOCK const &, BLOCK const &);                            \
+  template CSRMatrix<complex> sparse_matrix_compiled<complex>(                 \
+      OpSum const &, BLOCK const &, BLOCK const &);                            \
+  template int64_t sparse_matrix_memory_compiled<double>(                      \
+      OpSum const &, BLOCK const &, BLOCK const &);                            \
+  template int64_t sparse_matrix_memory_compiled<complex>(                     \
+      OpSum const &, BLOCK const &, BLOCK const &);
+
+INSTANTIATE_SPARSE_MATRIX(Spinhalf);
+INSTANTIATE_SPARSE_MATRIX(tJ);
+INSTANTIATE_SPARSE_MATRIX(Electron);
+
+#undef INSTANTIATE_SPARSE_MATRIX
+
+} // namespace xdiag
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <vector>
+
+#include <xdiag/blocks/electron.hpp>
+#include <xdiag/blocks/spinhalf.hpp>
+#include <xdiag/blocks/tj.hpp>
+#include <xdiag/common.hpp>
+#include <xdiag/extern/armadillo/armadillo>
+#include <xdiag/operators/opsum.hpp>
+
+namespace xdiag {
+
+// Matrix in compressed sparse row (CSR) format. The column indices and values
+// of row i are stored in the range [row_ptr[i], row_ptr[i+1]), sorted by
+// column index.
+template <typename coeff_t> struct CSRMatrix {
+  int64_t n_rows = 0;
+  int64_t n_cols = 0;
+  std::vector<int64_t> row_ptr;
+  std::vector<int64_t> col_idx;
+  std::vector<coeff_t> data;
+
+  int64_t nnz() const { return (int64_t)data.size(); }
+  int64_t memory() const { // in bytes
+    return (int64_t)(row_ptr.size() * sizeof(int64_t) +
+                     col_idx.size() * sizeof(int64_t) +
+                     data.size() * sizeof(coeff_t));
+  }
+};
+
+template <class block_t>
+CSRMatrix<double> sparse_matrix(OpSum const &ops, block_t const &block_in,
+                                block_t const &block_out,
+                                double precision = 1e-12);
+template <class block_t>
+CSRMatrix<double> sparse_matrix(OpSum const &ops, block_t const &block,
+                                double precision = 1e-12);
+template <class block_t>
+CSRMatrix<complex> sparse_matrixC(OpSum const &ops, block_t const &block_in,
+                                  block_t const &block_out,
+                                  double precision = 1e-12);
+template <class block_t>
+CSRMatrix<complex> sparse_matrixC(OpSum const &ops, block_t const &block,
+                                  double precision = 1e-12);
+
+// Estimates the number of bytes needed to build the sparse matrix. This
+// requires one sweep through the basis but no memory besides the row counts.
+// The estimate is an upper bound, since duplicate entries are merged later.
+template <class block_t>
+int64_t sparse_matrix_memory(OpSum const &ops, block_t const &block_in,
+                             block_t const &block_out, bool real = true,
+                             double precision = 1e-12);
+
+// Multiplies a sparse matrix with all columns of mat_in, w/o atomics
+template <typename coeff_t, typename vec_t>
+void apply(CSRMatrix<coeff_t> const &mat, arma::Mat<vec_t> const &mat_in,
+           arma::Mat<vec_t> &mat_out);
+
+// Memory in bytes an ApplyPlan may use to store the sparse matrix of an
+// OpSum. If the estimated memory exceeds the budget, the plan falls back to
+// matrix-free application. A budget of 0 (default) disables sparse matrices.
+void set_sparse_memory_budget(int64_t bytes);
+int64_t sparse_memory_budget();
+
+// developer methods
+template <typename coeff_t, class block_t>
+CSRMatrix<coeff_t> sparse_matrix_compiled(OpSum const &ops_compiled,
+                                          block_t const &block_in,
+                                          block_t const &block_out);
+template <typename coeff_t, class block_t>
+int64_t sparse_matrix_memory_compiled(OpSum const &ops_compiled,
+                                      block_t const &block_in,
+                                      block_t const &block_out);
+
+} // namespace xdiag
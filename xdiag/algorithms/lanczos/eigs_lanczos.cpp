@@ -55,13 +55,14 @@ eigs_lanczos_result_t eigs_lanczos(OpSum const &ops, Block const &block,
   State eigenvectors(block, !cplx, neigvals);
   state1 = state0;
 
+  ApplyPlan plan(ops, block, 1e-12, true);
   int64_t iter = 1;
   // Setup complex Lanczos run
   if (cplx) {
     arma::cx_vec v0 = state1.vectorC(0, false);
-    auto mult = [&iter, &ops, &block](arma::cx_vec const &v, arma::cx_vec &w) {
+    auto mult = [&iter, &plan](arma::cx_vec const &v, arma::cx_vec &w) {
       auto ta = rightnow();
-      apply(ops, block, v, block, w);
+      apply(plan, v, w);
       Log(1, "Lanczos iteration (rerun) {}", iter);
       timing(ta, rightnow(), "MVM", 1);
       ++iter;
@@ -81,9 +82,9 @@ eigs_lanczos_result_t eigs_lanczos(OpSum const &ops, Block const &block,
     // Setup real Lanczos run
   } else {
     arma::vec v0 = state1.vector(0, false);
-    auto mult = [&iter, &ops, &block](arma::vec const &v, arma::vec &w) {
+    auto mult = [&iter, &plan](arma::vec const &v, arma::vec &w) {
       auto ta = rightnow();
-      apply(ops, block, v, block, w);
+      apply(plan, v, w);
       Log(1, "Lanczos iteration {}", iter);
       timing(ta, rightnow(), "MVM", 1);
       ++iter;
@@ -134,4 +135,141 @@ eigs_lanczos_result_t eigs_lanczos(OpSum const &ops, Block const &block,
   return eigs_lanczos_result_t();
 }
 
+template <typename vec_t>
+static eigs_lanczos_result_t
+eigs_lanczos_single(OpSum const &ops, Block const &block, int64_t neigvals,
+                    double precision, int64_t max_iterations,
+                    double deflation_tol, int64_t random_seed) try {
+  using coeff_t = double_precision_t<vec_t>;
+  constexpr bool cplx = iscomplex<vec_t>();
+
+  // The random start vector is created again for the second run, such that
+  // no additional vector needs to be stored
+  auto start_vector = [&]() -> arma::Col<vec_t> {
+    State state0(block, !cplx);
+    fill(state0, RandomState(random_seed));
+    if constexpr (cplx) {
+      return arma::conv_to<arma::Col<vec_t>>::from(state0.vectorC(0, false));
+    } else {
+      return arma::conv_to<arma::Col<vec_t>>::from(state0.vector(0, false));
+    }
+  };
+
+  ApplyPlan plan(ops, block, 1e-12, true);
+  int64_t iter = 1;
+  auto mult = [&iter, &plan](arma::Col<vec_t> const &v, arma::Col<vec_t> &w) {
+    auto ta = rightnow();
+    apply(plan, v, w);
+    Log(1, "Lanczos iteration (single precision) {}", iter);
+    timing(ta, rightnow(), "MVM", 1);
+    ++iter;
+  };
+  auto dotf = [&block](arma::Col<vec_t> const &v, arma::Col<vec_t> const &w) {
+    return dot(block, v, w);
+  };
+
+  // Perform first run to compute eigenvalues
+  auto converged = [neigvals, precision](Tmatrix const &tmat) -> bool {
+    return lanczos::converged_eigenvalues(tmat, neigvals, precision);
+  };
+  lanczos::lanczos_result_t r;
+  {
+    arma::Col<vec_t> v0 = start_vector();
+    auto operation = [](arma::Col<vec_t> const &) {};
+    r = lanczos::lanczos(mult, dotf, converged, operation, v0, max_iterations,
+                         deflation_tol);
+  }
+
+  // Perform second run to compute the eigenvectors
+  arma::mat tmat = arma::diagmat(r.alphas);
+  if (r.alphas.n_rows > 1) {
+    tmat += arma::diagmat(r.betas.head(r.betas.size() - 1), 1) +
+            arma::diagmat(r.betas.head(r.betas.size() - 1), -1);
+  }
+
+  arma::vec reigs;
+  arma::mat revecs;
+  try {
+    arma::eig_sym(reigs, revecs, tmat);
+  } catch (...) {
+    XDIAG_THROW("Error diagonalizing tridiagonal matrix");
+  }
+
+  State eigenvectors(block, !cplx, neigvals);
+  int64_t n_rows = eigenvectors.n_rows();
+  auto evec = [&](int64_t k) -> coeff_t * {
+    if constexpr (cplx) {
+      return eigenvectors.colptrC(k);
+    } else {
+      return eigenvectors.colptr(k);
+    }
+  };
+
+  iter = 1;
+  auto operation = [&](arma::Col<vec_t> const &v) {
+    for (int64_t k = 0; k < neigvals; ++k) {
+      coeff_t *col = evec(k);
+      double c = revecs(iter - 1, k);
+      vec_t const *x = v.memptr();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+      for (int64_t i = 0; i < n_rows; ++i) {
+        col[i] += c * (coeff_t)x[i];
+      }
+    }
+  };
+  auto not_converged = [](Tmatrix const &) -> bool { return false; };
+  {
+    arma::Col<vec_t> v0 = start_vector();
+    lanczos::lanczos(mult, dotf, not_converged, operation, v0, r.niterations,
+                     deflation_tol);
+  }
+
+  // Refine eigenvalues by Rayleigh quotients in double precision
+  arma::vec eigenvalues = r.eigenvalues;
+  arma::Col<coeff_t> w(n_rows);
+  for (int64_t k = 0; k < neigvals; ++k) {
+    arma::Col<coeff_t> v(evec(k), n_rows, false, true);
+    v /= norm(block, v);
+    apply(plan, v, w);
+    double e = xdiag::real(dot(block, v, w));
+    w -= e * v;
+    Log(1, "Eigenvalue {}: Lanczos {}, refined {}, residual {}", k,
+        r.eigenvalues(k), e, norm(block, w));
+    eigenvalues(k) = e;
+  }
+
+  return {r.alphas,     r.betas,       eigenvalues,
+          eigenvectors, r.niterations, r.criterion};
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+  return eigs_lanczos_result_t();
+}
+
+eigs_lanczos_result_t eigs_lanczos_mixed(OpSum const &ops, Block const &block,
+                                         int64_t neigvals, double precision,
+                                         int64_t max_iterations,
+                                         bool force_complex,
+                                         double deflation_tol,
+                                         int64_t random_seed) try {
+  if (neigvals < 1) {
+    XDIAG_THROW("Argument \"neigvals\" needs to be >= 1");
+  }
+  precision = std::max(precision, 1e-7);
+  bool cplx = (!ops.isreal()) || !isreal(block) || force_complex;
+  if (cplx) {
+    return eigs_lanczos_single<std::complex<float>>(
+        ops, block, neigvals, precision, max_iterations, deflation_tol,
+        random_seed);
+  } else {
+    return eigs_lanczos_single<float>(ops, block, neigvals, precision,
+                                      max_iterations, deflation_tol,
+                                      random_seed);
+  }
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+  return eigs_lanczos_result_t();
+}
+
 } // namespace xdiag
@@ -27,4 +27,15 @@ eigs_lanczos(OpSum const &ops, Block const &block, State &state0,
              int64_t max_iterations = 1000, bool force_complex = false,
              double deflation_tol = 1e-7);
 
+// Lanczos with single precision work vectors, halving their memory and the
+// bandwidth per MVM. The eigenvectors are assembled in double precision and
+// the eigenvalues are refined by their Rayleigh quotients, whose error is of
+// the order of the squared residual. The convergence criterion can not be
+// tighter than single precision, smaller values of precision are raised.
+eigs_lanczos_result_t
+eigs_lanczos_mixed(OpSum const &ops, Block const &block,
+                   int64_t neigvals = 1, double precision = 1e-7,
+                   int64_t max_iterations = 1000, bool force_complex = false,
+                   double deflation_tol = 1e-7, int64_t random_seed = 42);
+
 } // namespace xdiag
@@ -34,15 +34,16 @@ eigvals_lanczos(OpSum const &ops, Block const &block, State &state0,
   auto converged = [neigvals, precision](Tmatrix const &tmat) -> bool {
     return lanczos::converged_eigenvalues(tmat, neigvals, precision);
   };
+  ApplyPlan plan(ops, block, 1e-12, true);
   lanczos::lanczos_result_t r;
   int64_t iter = 1;
   // Setup complex Lanczos run
   if (cplx) {
     state0.make_complex();
     arma::cx_vec v0 = state0.vectorC(0, false);
-    auto mult = [&iter, &ops, &block](arma::cx_vec const &v, arma::cx_vec &w) {
+    auto mult = [&iter, &plan](arma::cx_vec const &v, arma::cx_vec &w) {
       auto ta = rightnow();
-      apply(ops, block, v, block, w);
+      apply(plan, v, w);
       Log(1, "Lanczos iteration {}", iter);
       timing(ta, rightnow(), "MVM", 1);
       ++iter;
@@ -58,9 +59,9 @@ eigvals_lanczos(OpSum const &ops, Block const &block, State &state0,
     // Setup real Lanczos run
   } else {
     arma::vec v0 = state0.vector(0, false);
-    auto mult = [&iter, &ops, &block](arma::vec const &v, arma::vec &w) {
+    auto mult = [&iter, &plan](arma::vec const &v, arma::vec &w) {
       auto ta = rightnow();
-      apply(ops, block, v, block, w);
+      apply(plan, v, w);
       Log(1, "Lanczos iteration {}", iter);
       timing(ta, rightnow(), "MVM", 1);
       ++iter;
@@ -0,0 +1,330 @@
+#include "memory_estimate.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace xdiag {
+
+// Estimates are computed in floating point, such that parameters beyond the
+// range of int64_t saturate instead of overflowing
+static int64_t saturate(double x) {
+  double max = (double)std::numeric_limits<int64_t>::max();
+  return (x >= max) ? std::numeric_limits<int64_t>::max() : (int64_t)x;
+}
+
+static double binomial(int64_t n, int64_t k) {
+  double b = 1.0;
+  for (int64_t i = 1; i <= k; ++i) {
+    b = b * (double)(n - k + i) / (double)i;
+  }
+  return std::round(b);
+}
+
+static double raw_dim(int64_t n_sites, int64_t n_par) {
+  return (n_par == undefined) ? std::pow(2.0, n_sites)
+                              : binomial(n_sites, n_par);
+}
+
+static int64_t bit_size(int64_t n_sites) {
+  return (n_sites < 32) ? sizeof(uint32_t) : sizeof(uint64_t);
+}
+
+// Memory of the tables mirroring the implementations of LinTable,
+// GroupActionLookup, GroupActionSublattice and FermiTableSubsets
+static double lintable_memory(int64_t n) {
+  int64_t n_left = (n + 1) / 2;
+  return (std::pow(2.0, n_left) + std::pow(2.0, n - n_left)) * sizeof(int64_t);
+}
+
+static double group_action_memory(int64_t n_sites, int64_t n_symmetries,
+                                  int64_t bit_size) {
+  if (n_symmetries <= 1) {
+    return 0.;
+  }
+  int64_t n_prefix = n_sites / 2;
+  return n_symmetries *
+         (std::pow(2.0, n_prefix) + std::pow(2.0, n_sites - n_prefix)) *
+         bit_size;
+}
+
+static double group_action_sublattice_memory(int64_t n_sites,
+                                             int64_t n_symmetries,
+                                             int64_t n_sublat,
+                                             int64_t bit_size) {
+  double size_tables = std::pow(2.0, n_sites / n_sublat);
+  double per_sublat = size_tables * (bit_size / 2 + 16 + sizeof(int64_t) +
+                                     n_symmetries * bit_size);
+  return n_sublat * per_sublat + n_symmetries * sizeof(int64_t);
+}
+
+static double fermi_table_memory(int64_t n_sites, int64_t n_symmetries,
+                                 int64_t bit_size) {
+  if (n_symmetries <= 1) {
+    return 0.;
+  }
+  int64_t n_prefix = n_sites / 2;
+  return n_symmetries *
+         (std::pow(2.0, n_prefix) + std::pow(2.0, n_sites - n_prefix)) *
+         (bit_size + sizeof(uint8_t));
+}
+
+static void check_parameters(int64_t n_sites, int64_t n_up, int64_t n_dn,
+                             int64_t n_symmetries, int64_t n_sublat) try {
+  if ((n_sites < 0) || (n_sites > 64)) {
+    XDIAG_THROW("Invalid argument: n_sites must be between 0 and 64");
+  }
+  if ((n_up != undefined) && ((n_up < 0) || (n_up > n_sites))) {
+    XDIAG_THROW("Invalid argument: n_up must be between 0 and n_sites");
+  }
+  if ((n_dn != undefined) && ((n_dn < 0) || (n_dn > n_sites))) {
+    XDIAG_THROW("Invalid argument: n_dn must be between 0 and n_sites");
+  }
+  if (n_symmetries < 1) {
+    XDIAG_THROW("Invalid argument: n_symmetries must be >= 1");
+  }
+  if ((n_sublat < 0) || (n_sublat > 5)) {
+    XDIAG_THROW("Invalid argument: n_sublat must be between 0 and 5");
+  }
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+}
+
+int64_t spinhalf_dim_estimate(int64_t n_sites, int64_t n_up,
+                              int64_t n_symmetries) try {
+  check_parameters(n_sites, n_up, undefined, n_symmetries, 0);
+  return saturate(std::ceil(raw_dim(n_sites, n_up) / n_symmetries));
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+  return 0;
+}
+
+int64_t tj_dim_estimate(int64_t n_sites, int64_t n_up, int64_t n_dn,
+                        int64_t n_symmetries) try {
+  check_parameters(n_sites, n_up, n_dn, n_symmetries, 0);
+  if ((n_up == undefined) || (n_dn == undefined) || (n_up + n_dn > n_sites)) {
+    XDIAG_THROW("Invalid argument: tJ blocks require n_up + n_dn <= n_sites");
+  }
+  double raw = binomial(n_sites, n_up) * binomial(n_sites - n_up, n_dn);
+  return saturate(std::ceil(raw / n_symmetries));
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+  return 0;
+}
+
+int64_t electron_dim_estimate(int64_t n_sites, int64_t n_up, int64_t n_dn,
+                              int64_t n_symmetries) try {
+  check_parameters(n_sites, n_up, n_dn, n_symmetries, 0);
+  if ((n_up == undefined) != (n_dn == undefined)) {
+    XDIAG_THROW("Invalid argument: either both or none of n_up and n_dn "
+                "must be defined");
+  }
+  double raw = raw_dim(n_sites, n_up) * raw_dim(n_sites, n_dn);
+  return saturate(std::ceil(raw / n_symmetries));
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+  return 0;
+}
+
+BlockMemory spinhalf_memory_estimate(int64_t n_sites, int64_t n_up,
+                                     int64_t n_symmetries, int64_t n_sublat,
+                                     std::string backend) try {
+  check_parameters(n_sites, n_up, undefined, n_symmetries, n_sublat);
+  if ((backend != "lookup") && (backend != "compact")) {
+    XDIAG_THROW(fmt::format("Unknown backend \"{}\", must be either "
+                            "\"lookup\" or \"compact\"",
+                            backend));
+  }
+  BlockMemory memory;
+  double raw = raw_dim(n_sites, n_up);
+
+  // no symmetries: BasisNoSz stores nothing, BasisSz all states
+  if (n_symmetries == 1) {
+    if (n_up != undefined) {
+      memory.states = saturate(raw * bit_size(n_sites));
+      memory.lintables = saturate(lintable_memory(n_sites));
+    }
+    return memory;
+  }
+
+  // symmetric spinhalf bases always use 64 bit states
+  double dim = std::ceil(raw / n_symmetries);
+  int64_t bsize = sizeof(uint64_t);
+  if (n_sublat > 0) { // BasisSublattice
+    double n_prefixes = std::min(dim, std::pow(2.0, std::min<int64_t>(
+                                                        24, n_sites)));
+    memory.states = saturate(dim * bsize);
+    memory.norms = saturate(dim * sizeof(double));
+    memory.indices = saturate(n_prefixes * (bsize + 24));
+    memory.group_action = saturate(group_action_sublattice_memory(
+        n_sites, n_symmetries, n_sublat, bsize));
+  } else if ((backend == "compact") && (n_up != undefined)) {
+    // BasisSymmetricSzCompact
+    memory.states = saturate(dim * bsize);
+    memory.norms = saturate(dim * sizeof(double));
+    memory.indices =
+        saturate((std::pow(2.0, n_sites / 2) + 1) * sizeof(int64_t));
+    memory.group_action =
+        saturate(group_action_memory(n_sites, n_symmetries, bsize));
+  } else { // BasisSymmetricSz or BasisSymmetricNoSz
+    memory.states = saturate(dim * bsize);
+    memory.norms = saturate(dim * sizeof(double));
+    // index, one symmetry and symmetry limits for every raw state
+    memory.indices = saturate(raw * (2 * sizeof(int64_t) + 16));
+    if (n_up != undefined) {
+      memory.lintables = saturate(lintable_memory(n_sites));
+    }
+    memory.group_action =
+        saturate(group_action_memory(n_sites, n_symmetries, bsize));
+  }
+  return memory;
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+  return BlockMemory();
+}
+
+// Symmetric tJ and Electron bases store the representatives of the ups and
+// the dns configurations, which for ups with trivial stabilizer are shared
+// among all ups in front of the storage
+static BlockMemory
+symmetric_np_memory(int64_t n_sites, double raw_ups, double raw_dns,
+                    int64_t n_symmetries, int64_t n_sublat) {
+  int64_t bsize = bit_size(n_sites);
+  double reps_ups = std::ceil(raw_ups / n_symmetries);
+  BlockMemory memory;
+  memory.states = saturate((reps_ups + raw_dns) * bsize);
+  memory.norms = saturate(raw_dns * sizeof(double));
+  memory.indices = saturate(reps_ups * (sizeof(int64_t) + 16));
+  memory.group_action =
+      saturate(group_action_memory(n_sites, n_symmetries, bsize));
+  if (n_sublat == 0) {
+    memory.indices += saturate(raw_ups * (2 * sizeof(int64_t) + 16));
+  } else {
+    memory.group_action += saturate(group_action_sublattice_memory(
+        n_sites, n_symmetries, n_sublat, bsize));
+  }
+  return memory;
+}
+
+BlockMemory tj_memory_estimate(int64_t n_sites, int64_t n_up, int64_t n_dn,
+                               int64_t n_symmetries, int64_t n_sublat) try {
+  check_parameters(n_sites, n_up, n_dn, n_symmetries, n_sublat);
+  if ((n_up == undefined) || (n_dn == undefined) || (n_up + n_dn > n_sites)) {
+    XDIAG_THROW("Invalid argument: tJ blocks require n_up + n_dn <= n_sites");
+  }
+  BlockMemory memory;
+  if (n_symmetries == 1) { // BasisNp
+    memory.lintables =
+        saturate(lintable_memory(n_sites) + lintable_memory(n_sites - n_up));
+  } else { // BasisSymmetricNp
+    memory = symmetric_np_memory(n_sites, binomial(n_sites, n_up),
+                                 binomial(n_sites - n_up, n_dn), n_symmetries,
+                                 n_sublat);
+    memory.lintables = saturate(2 * lintable_memory(n_sites) +
+                             lintable_memory(n_sites - n_up));
+    memory.fermi_tables = saturate(
+        2 * fermi_table_memory(n_sites, n_symmetries, bit_size(n_sites)));
+  }
+  return memory;
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+  return BlockMemory();
+}
+
+BlockMemory electron_memory_estimate(int64_t n_sites, int64_t n_up,
+                                     int64_t n_dn, int64_t n_symmetries,
+                                     int64_t n_sublat) try {
+  check_parameters(n_sites, n_up, n_dn, n_symmetries, n_sublat);
+  if ((n_up == undefined) != (n_dn == undefined)) {
+    XDIAG_THROW("Invalid argument: either both or none of n_up and n_dn "
+                "must be defined");
+  }
+  bool np = (n_up != undefined);
+  BlockMemory memory;
+  if (n_symmetries == 1) { // BasisNp or BasisNoNp
+    if (np) {
+      memory.lintables = saturate(2 * lintable_memory(n_sites));
+    }
+  } else { // BasisSymmetricNp or BasisSymmetricNoNp
+    memory = symmetric_np_memory(n_sites, raw_dim(n_sites, n_up),
+                                 raw_dim(n_sites, n_dn), n_symmetries,
+                                 np ? n_sublat : 0);
+    double fermi = fermi_table_memory(n_sites, n_symmetries, bit_size(n_sites));
+    if (np) {
+      memory.lintables = saturate(2 * lintable_memory(n_sites));
+      memory.fermi_tables = saturate(2 * fermi);
+    } else {
+      memory.fermi_tables = saturate(fermi);
+    }
+  }
+  return memory;
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+  return BlockMemory();
+}
+
+int64_t eigs_lanczos_memory_estimate(int64_t dim, bool real,
+                                     int64_t neigvals) try {
+  if (dim < 0) {
+    XDIAG_THROW("Invalid argument: dim < 0");
+  } else if (neigvals < 1) {
+    XDIAG_THROW("Argument \"neigvals\" needs to be >= 1");
+  }
+  // start state, its working copy, two Lanczos vectors, the cached diagonal
+  // and the eigenvectors
+  double coeff_size = real ? sizeof(double) : sizeof(complex);
+  return saturate((5. + neigvals) * dim * coeff_size);
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+  return 0;
+}
+
+int64_t time_evolve_memory_estimate(int64_t dim, int64_t m) try {
+  if (dim < 0) {
+    XDIAG_THROW("Invalid argument: dim < 0");
+  } else if (m < 1) {
+    XDIAG_THROW("Invalid argument: Krylov dimension m < 1");
+  }
+  // state, its copy, the cached diagonal, m + 1 Krylov vectors and two
+  // vectors in the matrix-vector multiplication (all complex)
+  return saturate((m + 6.) * dim * sizeof(complex));
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+  return 0;
+}
+
+int64_t matrix_memory_estimate(int64_t dim, bool real) try {
+  if (dim < 0) {
+    XDIAG_THROW("Invalid argument: dim < 0");
+  }
+  double coeff_size = real ? sizeof(double) : sizeof(complex);
+  return saturate((double)dim * (double)dim * coeff_size);
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+  return 0;
+}
+
+int64_t eigs_lanczos_memory_estimate(Block const &block, bool real,
+                                     int64_t neigvals) try {
+  return eigs_lanczos_memory_estimate(size(block), real && isreal(block),
+                                      neigvals);
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+  return 0;
+}
+
+int64_t time_evolve_memory_estimate(Block const &block, int64_t m) try {
+  return time_evolve_memory_estimate(size(block), m);
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+  return 0;
+}
+
+int64_t matrix_memory_estimate(Block const &block, bool real) try {
+  return matrix_memory_estimate(size(block), real && isreal(block));
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+  return 0;
+}
+
+} // namespace xdiag
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <string>
+
+#include <xdiag/blocks/blocks.hpp>
+#include <xdiag/common.hpp>
+#include <xdiag/utils/block_memory.hpp>
+
+namespace xdiag {
+
+// Pre-flight estimates of the memory (in bytes) needed to build a block and
+// to run algorithms on it. The block estimates only use the parameters the
+// block would be constructed with and do not build any tables. A value of
+// "undefined" for n_up / n_dn denotes non-conserved particle numbers and
+// n_symmetries is the size of the permutation group (1 without symmetries).
+// For symmetric blocks the dimension is approximated by the dimension without
+// symmetries divided by n_symmetries, which is accurate up to the few
+// representatives with a non-trivial stabilizer.
+int64_t spinhalf_dim_estimate(int64_t n_sites, int64_t n_up = undefined,
+                              int64_t n_symmetries = 1);
+int64_t tj_dim_estimate(int64_t n_sites, int64_t n_up, int64_t n_dn,
+                        int64_t n_symmetries = 1);
+int64_t electron_dim_estimate(int64_t n_sites, int64_t n_up = undefined,
+                              int64_t n_dn = undefined,
+                              int64_t n_symmetries = 1);
+
+BlockMemory spinhalf_memory_estimate(int64_t n_sites, int64_t n_up = undefined,
+                                     int64_t n_symmetries = 1,
+                                     int64_t n_sublat = 0,
+                                     std::string backend = "lookup");
+BlockMemory tj_memory_estimate(int64_t n_sites, int64_t n_up, int64_t n_dn,
+                               int64_t n_symmetries = 1, int64_t n_sublat = 0);
+BlockMemory electron_memory_estimate(int64_t n_sites, int64_t n_up = undefined,
+                                     int64_t n_dn = undefined,
+                                     int64_t n_symmetries = 1,
+                                     int64_t n_sublat = 0);
+
+// Memory of the vectors allocated by an algorithm, in addition to the memory
+// of the block itself. A sparse matrix stored by the ApplyPlan is bounded by
+// sparse_memory_budget() and not included.
+int64_t eigs_lanczos_memory_estimate(int64_t dim, bool real = true,
+                                     int64_t neigvals = 1);
+int64_t time_evolve_memory_estimate(int64_t dim, int64_t m = 5);
+int64_t matrix_memory_estimate(int64_t dim, bool real = true);
+
+// Same estimates for an existing block, using its size on this process
+int64_t eigs_lanczos_memory_estimate(Block const &block, bool real = true,
+                                     int64_t neigvals = 1);
+int64_t time_evolve_memory_estimate(Block const &block, int64_t m = 5);
+int64_t matrix_memory_estimate(Block const &block, bool real = true);
+
+} // namespace xdiag
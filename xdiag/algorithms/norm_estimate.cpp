@@ -114,11 +114,12 @@ double norm_estimate(OpSum const &ops, Block const &block,
 template <typename block_t>
 double norm_estimate(OpSum const &ops, block_t const &block,
                      int64_t n_max_attempts, uint64_t seed) try {
+  ApplyPlan plan(ops, block);
   int iter = 1;
-  auto apply_A = [&iter, &ops, &block](arma::cx_vec const &v) {
+  auto apply_A = [&iter, &plan](arma::cx_vec const &v) {
     auto ta = rightnow();
     auto w = arma::cx_vec(v.n_rows, arma::fill::zeros);
-    apply(ops, block, v, block, w);
+    apply(plan, v, w);
     Log(2, "Norm estimation iteration {}", iter);
     timing(ta, rightnow(), "MVM", 2);
     ++iter;
@@ -80,10 +80,11 @@ State exp_sym_v(OpSum const &ops, State state, double tau, bool normalize,
 
   // Real time evolution is possible
   if (state.isreal() && ops.isreal()) {
+    ApplyPlan plan(ops, block, 1e-12, true);
     int iter = 1;
-    auto mult = [&iter, &ops, &block](arma::vec const &v, arma::vec &w) {
+    auto mult = [&iter, &plan](arma::vec const &v, arma::vec &w) {
       auto ta = rightnow();
-      apply(ops, block, v, block, w);
+      apply(plan, v, w);
       Log(2, "Lanczos iteration {}", iter);
       timing(ta, rightnow(), "MVM", 1);
       ++iter;
@@ -109,10 +110,11 @@ State exp_sym_v(OpSum const &ops, State state, complex tau, bool normalize,
   auto const &block = state.block();
   state.make_complex();
 
+  ApplyPlan plan(ops, block, 1e-12, true);
   int iter = 1;
-  auto mult = [&iter, &ops, &block](arma::cx_vec const &v, arma::cx_vec &w) {
+  auto mult = [&iter, &plan](arma::cx_vec const &v, arma::cx_vec &w) {
     auto ta = rightnow();
-    apply(ops, block, v, block, w);
+    apply(plan, v, w);
     Log(2, "Lanczos iteration {}", iter);
     timing(ta, rightnow(), "MVM", 1);
     ++iter;
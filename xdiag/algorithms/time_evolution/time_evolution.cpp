@@ -28,11 +28,12 @@ std::tuple<double, double> time_evolve_inplace(OpSum const &ops, State &state,
     Log(1, "norm estimate: {}", anorm);
   }
 
+  ApplyPlan plan(ops, block, 1e-12, true);
   int64_t iter = 1;
-  auto apply_A = [&iter, &ops, &block](arma::cx_vec const &v) {
+  auto apply_A = [&iter, &plan](arma::cx_vec const &v) {
     auto ta = rightnow();
     auto w = arma::cx_vec(v.n_rows, arma::fill::zeros);
-    apply(ops, block, v, block, w);
+    apply(plan, v, w);
     w *= -1.0i;
     Log(2, "Lanczos iteration {}", iter);
     timing(ta, rightnow(), "MVM", 2);
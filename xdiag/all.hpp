@@ -11,7 +11,6 @@
 #ifdef _OPENMP
 #include <omp.h>
 #include <xdiag/parallel/omp/omp_utils.hpp>
-// #include <xdiag/symmetries/operations/representative_list_omp.hpp>
 #endif
 
 #ifdef XDIAG_USE_HDF5
@@ -26,6 +25,7 @@
 #include <xdiag/config.hpp>
 
 #include <xdiag/bits/bitops.hpp>
+#include <xdiag/utils/block_memory.hpp>
 #include <xdiag/utils/close.hpp>
 #include <xdiag/utils/iochecks.hpp>
 #include <xdiag/utils/logger.hpp>
@@ -35,7 +35,9 @@
 
 #include <xdiag/algebra/algebra.hpp>
 #include <xdiag/algebra/apply.hpp>
+#include <xdiag/algebra/apply_mode.hpp>
 #include <xdiag/algebra/matrix.hpp>
+#include <xdiag/algebra/sparse_matrix.hpp>
 
 // Includes for different block types
 #include <xdiag/blocks/blocks.hpp>
@@ -90,6 +92,7 @@
 #include <xdiag/operators/opsum.hpp>
 #include <xdiag/operators/symmetrize.hpp>
 
+#include <xdiag/algorithms/memory_estimate.hpp>
 #include <xdiag/algorithms/norm_estimate.hpp>
 #include <xdiag/algorithms/sparse_diag.hpp>
 
@@ -111,6 +114,7 @@
 #include <xdiag/algorithms/time_evolution/zahexpv.hpp>
 
 #include <xdiag/io/args.hpp>
+#include <xdiag/io/basis_cache.hpp>
 #include <xdiag/io/file_h5.hpp>
 #include <xdiag/io/file_toml.hpp>
 
@@ -8,6 +8,7 @@
 #include <xdiag/basis/electron/apply/apply_u.hpp>
 
 #include <xdiag/common.hpp>
+#include <xdiag/operators/op_type.hpp>
 #include <xdiag/operators/opsum.hpp>
 
 namespace xdiag::basis::electron {
@@ -21,28 +22,36 @@ void apply_terms(OpSum const &ops, BasisIn const &basis_in,
   OpSum ops_dns;
   OpSum ops_diag;
   OpSum ops_mixed;
-  for (auto op : ops) {
-    std::string type = op.type();
-    if ((type == "HOPUP") || (type == "CDAGUP") || (type == "CUP")) {
+  for (auto const &op : ops) {
+    switch (op_type(op)) {
+    case OpType::HOPUP:
+    case OpType::CDAGUP:
+    case OpType::CUP:
       ops_ups += op;
-    } else if ((type == "HOPDN") || (type == "CDAGDN") || (type == "CDN")) {
+      break;
+    case OpType::HOPDN:
+    case OpType::CDAGDN:
+    case OpType::CDN:
       ops_dns += op;
-    } else if ((type == "ISING") || (type == "NUMBERUP") ||
-               (type == "NUMBERDN")) {
+      break;
+    case OpType::ISING:
+    case OpType::NUMBERUP:
+    case OpType::NUMBERDN:
       ops_diag += op;
-    } else if (type == "EXCHANGE") {
+      break;
+    case OpType::EXCHANGE:
       ops_mixed += op;
-    } else {
-      XDIAG_THROW(fmt::format("Error: Unknown Op of type \"{}\"", type));
+      break;
+    default:
+      XDIAG_THROW(fmt::format("Error: Unknown Op of type \"{}\"", op.type()));
     }
   }
 
   // Diagonal terms
-  for (auto op : ops_diag) {
-    std::string type = op.type();
-    if (type == "ISING") {
+  for (auto const &op : ops_diag) {
+    if (op_type(op) == OpType::ISING) {
       electron::apply_ising<bit_t, coeff_t, symmetric>(op, basis_in, fill);
-    } else if ((type == "NUMBERUP") || (type == "NUMBERDN")) {
+    } else { // NUMBERUP or NUMBERDN
       electron::apply_number<bit_t, coeff_t, symmetric>(op, basis_in, fill);
     }
   }
@@ -59,32 +68,23 @@ void apply_terms(OpSum const &ops, BasisIn const &basis_in,
   }
 
   // terms on both ups and dns
-  for (auto op : ops_mixed) {
-    std::string type = op.type();
-    if (type == "EXCHANGE") {
-      electron::apply_exchange<bit_t, coeff_t, symmetric>(op, basis_in, fill);
-    }
-  }
-
-  // terms acting only on ups
-  for (auto op : ops_ups) {
-    std::string type = op.type();
-    if (type == "HOPUP") {
-      electron::apply_hopping<bit_t, coeff_t, symmetric>(op, basis_in, fill);
-    } else if ((type == "CDAGUP") || (type == "CUP")) {
-      electron::apply_raise_lower<bit_t, coeff_t, symmetric>(op, basis_in,
-                                                             basis_out, fill);
-    }
+  for (auto const &op : ops_mixed) {
+    electron::apply_exchange<bit_t, coeff_t, symmetric>(op, basis_in, fill);
   }
 
-  // terms acting only on dns
-  for (auto op : ops_dns) {
-    std::string type = op.type();
-    if (type == "HOPDN") {
-      electron::apply_hopping<bit_t, coeff_t, symmetric>(op, basis_in, fill);
-    } else if ((type == "CDAGDN") || (type == "CDN")) {
-      electron::apply_raise_lower<bit_t, coeff_t, symmetric>(op, basis_in,
-                                                             basis_out, fill);
+  // terms acting only on ups or only on dns
+  for (OpSum const *ops_spin : {&ops_ups, &ops_dns}) {
+    for (auto const &op : *ops_spin) {
+      switch (op_type(op)) {
+      case OpType::HOPUP:
+      case OpType::HOPDN:
+        electron::apply_hopping<bit_t, coeff_t, symmetric>(op, basis_in, fill);
+        break;
+      default: // CDAGUP, CUP, CDAGDN or CDN
+        electron::apply_raise_lower<bit_t, coeff_t, symmetric>(
+            op, basis_in, basis_out, fill);
+        break;
+      }
     }
   }
 } catch (Error const &e) {
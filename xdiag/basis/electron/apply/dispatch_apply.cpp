@@ -1,17 +1,27 @@
 #include "dispatch_apply.hpp"
 
+#include <xdiag/algebra/apply_mode.hpp>
 #include <xdiag/algebra/fill.hpp>
 #include <xdiag/basis/electron/apply/dispatch.hpp>
 
 namespace xdiag::basis::electron {
 
-template <typename coeff_t>
+template <typename vec_t>
 void dispatch_apply(OpSum const &ops, Electron const &block_in,
-                    arma::Col<coeff_t> const &vec_in, Electron const &block_out,
-                    arma::Col<coeff_t> &vec_out) try {
-  auto fill = [&](int64_t idx_in, int64_t idx_out, coeff_t val) {
-    return fill_apply(vec_in, vec_out, idx_in, idx_out, val);
-  };
+                    arma::Col<vec_t> const &vec_in, Electron const &block_out,
+                    arma::Col<vec_t> &vec_out) try {
+  using coeff_t = double_precision_t<vec_t>;
+#ifdef _OPENMP
+  if constexpr (std::is_same<coeff_t, vec_t>::value) {
+    if (apply_mode("Electron") == "private") {
+      apply_private(vec_in, vec_out, [&](auto &&fill) {
+        dispatch<coeff_t>(ops, block_in, block_out, fill);
+      });
+      return;
+    }
+  }
+#endif
+  FillApply<coeff_t, vec_t> fill{vec_in.memptr(), vec_out.memptr()};
   dispatch<coeff_t>(ops, block_in, block_out, fill);
 } catch (Error const &error) {
   XDIAG_RETHROW(error);
@@ -22,14 +32,32 @@ template void dispatch_apply(OpSum const &, Electron const &, arma::vec const &,
 template void dispatch_apply(OpSum const &, Electron const &,
                              arma::cx_vec const &, Electron const &block,
                              arma::cx_vec &);
+template void dispatch_apply(OpSum const &, Electron const &,
+                             arma::fvec const &, Electron const &block,
+                             arma::fvec &);
+template void dispatch_apply(OpSum const &, Electron const &,
+                             arma::cx_fvec const &, Electron const &block,
+                             arma::cx_fvec &);
 
 template <typename coeff_t>
 void dispatch_apply(OpSum const &ops, Electron const &block_in,
                     arma::Mat<coeff_t> const &mat_in, Electron const &block_out,
                     arma::Mat<coeff_t> &mat_out) try {
-  auto fill = [&](int64_t idx_in, int64_t idx_out, coeff_t val) {
-    return fill_apply(mat_in, mat_out, idx_in, idx_out, val);
-  };
+#ifdef _OPENMP
+  if (apply_mode("Electron") == "private") {
+    apply_private(mat_in, mat_out, [&](auto &&fill) {
+      dispatch<coeff_t>(ops, block_in, block_out, fill);
+    });
+    return;
+  }
+#endif
+  if (mat_in.n_cols > 1) {
+    apply_interleaved(mat_in, mat_out, [&](auto &&fill) {
+      dispatch<coeff_t>(ops, block_in, block_out, fill);
+    });
+    return;
+  }
+  FillApply<coeff_t> fill{mat_in.memptr(), mat_out.memptr()};
   dispatch<coeff_t>(ops, block_in, block_out, fill);
 } catch (Error const &error) {
   XDIAG_RETHROW(error);
@@ -2,6 +2,8 @@
 
 #include <functional>
 
+#include <xdiag/algebra/fill.hpp>
+
 namespace xdiag::basis::electron {
 
 template <typename bit_t, typename coeff_t, bool symmetric, bool fermi_ups,
@@ -129,7 +131,7 @@ void generic_term_dns(BasisIn &&basis_in, BasisOut &&basis_out,
             int64_t idx_in = idx_dns_in;
             for (bit_t ups : basis_in.states_ups()) {
               bool fermi = bits::popcnt(ups) & 1;
-              fill(idx_in, idx_out, fermi ? coeff : -coeff);
+              fill_exclusive(fill, idx_in, idx_out, fermi ? coeff : -coeff);
               idx_out += size_dns_out;
               idx_in += size_dns_in;
             }
@@ -137,7 +139,7 @@ void generic_term_dns(BasisIn &&basis_in, BasisOut &&basis_out,
             for (int64_t idx_out = idx_out_start, idx_in = idx_dns_in;
                  idx_out < idx_out_end;
                  idx_out += size_dns_out, idx_in += size_dns_in) {
-              fill(idx_in, idx_out, coeff);
+              fill_exclusive(fill, idx_in, idx_out, coeff);
             }
           }
         }
@@ -2,6 +2,8 @@
 
 #include <vector>
 
+#include <xdiag/algebra/fill.hpp>
+
 namespace xdiag::basis::electron {
 
 template <typename bit_t, typename coeff_t, bool symmetric, class BasisIn,
@@ -113,12 +115,10 @@ void generic_term_ups(BasisIn &&basis_in, BasisOut &&basis_out,
 
           int64_t idx_in_start = idx_ups_in * size_dns_in;
           int64_t idx_out_start = idx_ups_out * size_dns_out;
-          int64_t idx_out_end = (idx_ups_out + 1) * size_dns_out;
 
-          for (int64_t idx_out = idx_out_start, idx_in = idx_in_start;
-               idx_out < idx_out_end; ++idx_out, ++idx_in) {
-            fill(idx_in, idx_out, coeff);
-          }
+          // term_action is injective, so no other thread writes to this
+          // up-block of the output and the contiguous dns are updated at once
+          fill_axpy(fill, idx_in_start, idx_out_start, size_dns_out, coeff);
         }
       }
 
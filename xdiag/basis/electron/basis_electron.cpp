@@ -8,6 +8,9 @@ int64_t dim(BasisElectron const &basis) {
 int64_t size(BasisElectron const &basis) {
   return std::visit([&](auto &&b) { return b.size(); }, basis);
 }
+BlockMemory memory(BasisElectron const &basis) {
+  return std::visit([&](auto &&b) { return b.memory(); }, basis);
+}
 
 template <typename bit_t> bool has_bit_t(BasisElectron const &basis) try {
   return std::visit(
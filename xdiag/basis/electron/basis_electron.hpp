@@ -6,6 +6,7 @@
 #include <xdiag/basis/electron/basis_symmetric_no_np.hpp>
 #include <xdiag/basis/electron/basis_symmetric_np.hpp>
 #include <xdiag/common.hpp>
+#include <xdiag/utils/block_memory.hpp>
 
 namespace xdiag::basis {
 
@@ -35,6 +36,7 @@ using BasisElectronIterator =
 
 int64_t dim(BasisElectron const &basis);
 int64_t size(BasisElectron const &basis);
+BlockMemory memory(BasisElectron const &basis);
 template <typename bit_t> bool has_bit_t(BasisElectron const &);
 
 } // namespace xdiag::basis
@@ -76,6 +76,10 @@ SubsetsIndexThread<bit_t> BasisNoNp<bit_t>::states_indices_dns_thread() const {
 }
 #endif
 
+template <typename bit_t> BlockMemory BasisNoNp<bit_t>::memory() const {
+  return BlockMemory();
+}
+
 template class BasisNoNp<uint32_t>;
 template class BasisNoNp<uint64_t>;
 
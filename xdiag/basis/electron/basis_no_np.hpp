@@ -4,6 +4,7 @@
 
 #include <xdiag/combinatorics/subsets.hpp>
 #include <xdiag/combinatorics/subsets_index.hpp>
+#include <xdiag/utils/block_memory.hpp>
 
 namespace xdiag::basis::electron {
 
@@ -21,6 +22,7 @@ public:
 
   int64_t dim() const;
   int64_t size() const;
+  BlockMemory memory() const;
   iterator_t begin() const;
   iterator_t end() const;
 
@@ -89,6 +89,12 @@ BasisNp<bit_t>::states_indices_dns_thread() const {
 }
 #endif
 
+template <typename bit_t> BlockMemory BasisNp<bit_t>::memory() const {
+  BlockMemory memory;
+  memory.lintables = lintable_ups_.memory() + lintable_dns_.memory();
+  return memory;
+}
+
 template class BasisNp<uint32_t>;
 template class BasisNp<uint64_t>;
 
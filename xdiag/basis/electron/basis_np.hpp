@@ -4,6 +4,7 @@
 #include <xdiag/combinatorics/combinations_index.hpp>
 #include <xdiag/combinatorics/lin_table.hpp>
 #include <xdiag/common.hpp>
+#include <xdiag/utils/block_memory.hpp>
 
 namespace xdiag::basis::electron {
 
@@ -20,6 +21,7 @@ public:
   BasisNp(int n_sites, int n_up, int n_dn);
 
   int64_t size() const;
+  BlockMemory memory() const;
   int64_t dim() const;
   iterator_t begin() const;
   iterator_t end() const;
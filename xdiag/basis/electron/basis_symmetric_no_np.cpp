@@ -88,6 +88,21 @@ Representation const &BasisSymmetricNoNp<bit_t>::irrep() const {
   return irrep_;
 }
 
+template <typename bit_t>
+BlockMemory BasisSymmetricNoNp<bit_t>::memory() const {
+  using span_pair_t = std::pair<span_size_t, span_size_t>;
+  BlockMemory memory;
+  memory.states = (reps_up_.size() + dns_storage_.size()) * sizeof(bit_t);
+  memory.norms = norms_storage_.size() * sizeof(double);
+  memory.indices =
+      (idces_up_.size() + syms_up_.size() + ups_offset_.size()) *
+          sizeof(int64_t) +
+      (sym_limits_up_.size() + dns_limits_.size()) * sizeof(span_pair_t);
+  memory.group_action = group_action_.memory();
+  memory.fermi_tables = fermi_table_.memory();
+  return memory;
+}
+
 template class BasisSymmetricNoNp<uint32_t>;
 template class BasisSymmetricNoNp<uint64_t>;
 
@@ -12,6 +12,7 @@
 #include <xdiag/symmetries/operations/symmetry_operations.hpp>
 #include <xdiag/symmetries/permutation_group.hpp>
 #include <xdiag/symmetries/representation.hpp>
+#include <xdiag/utils/block_memory.hpp>
 
 namespace xdiag::basis::electron {
 
@@ -32,6 +33,7 @@ public:
 
   int64_t dim() const;
   int64_t size() const;
+  BlockMemory memory() const;
   iterator_t begin() const;
   iterator_t end() const;
   int64_t index(bit_t ups, bit_t dns) const;
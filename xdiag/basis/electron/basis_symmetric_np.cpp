@@ -12,8 +12,9 @@ namespace xdiag::basis::electron {
 template <class bit_t>
 BasisSymmetricNp<bit_t>::BasisSymmetricNp(int64_t n_sites, int64_t nup,
                                           int64_t ndn, PermutationGroup group,
-                                          Representation irrep)
-    : n_sites_(n_sites), n_up_(nup), n_dn_(ndn),
+                                          Representation irrep,
+                                          int64_t n_sublat)
+    : n_sites_(n_sites), n_up_(nup), n_dn_(ndn), n_sublat_(n_sublat),
       group_action_(allowed_subgroup(group, irrep)), irrep_(irrep),
       raw_ups_size_(combinatorics::binomial(n_sites, nup)),
       raw_dns_size_(combinatorics::binomial(n_sites, ndn)),
@@ -33,10 +34,20 @@ BasisSymmetricNp<bit_t>::BasisSymmetricNp(int64_t n_sites, int64_t nup,
         "n_sites does not match the n_sites in PermutationGroup"));
   }
 
-  std::tie(reps_up_, idces_up_, syms_up_, sym_limits_up_) =
-      symmetries::representatives_indices_symmetries_limits<bit_t>(
-          combinatorics::CombinationsIndexing<bit_t>(n_sites, nup),
-          group_action_);
+  if (n_sublat == 0) {
+    std::tie(reps_up_, idces_up_, syms_up_, sym_limits_up_) =
+        symmetries::representatives_indices_symmetries_limits<bit_t>(
+            combinatorics::CombinationsIndexing<bit_t>(n_sites, nup),
+            group_action_);
+  } else {
+    auto trivial_irrep = trivial_representation(group_action_.n_symmetries());
+    reps_up_ = symmetries::representatives_norms<bit_t>(
+                   combinatorics::CombinationsIndexing<bit_t>(n_sites, nup),
+                   group_action_, trivial_irrep)
+                   .first;
+    rep_sublattice_up_ = RepresentativeSublattice<bit_t>(
+        n_sublat, allowed_subgroup(group, irrep), reps_up_);
+  }
   std::tie(dns_storage_, norms_storage_, dns_limits_, ups_offset_, size_) =
       symmetries::electron_dns_norms_limits_offset_size(
           reps_up_, Combinations<bit_t>(n_sites, ndn), group_action_, irrep_);
@@ -51,6 +62,9 @@ template <class bit_t> int64_t BasisSymmetricNp<bit_t>::n_up() const {
 template <class bit_t> int64_t BasisSymmetricNp<bit_t>::n_dn() const {
   return n_dn_;
 }
+template <class bit_t> int64_t BasisSymmetricNp<bit_t>::n_sublat() const {
+  return n_sublat_;
+}
 
 template <class bit_t> int64_t BasisSymmetricNp<bit_t>::dim() const {
   return size_;
@@ -95,6 +109,25 @@ Representation const &BasisSymmetricNp<bit_t>::irrep() const {
   return irrep_;
 }
 
+template <typename bit_t>
+BlockMemory BasisSymmetricNp<bit_t>::memory() const {
+  using span_pair_t = std::pair<span_size_t, span_size_t>;
+  BlockMemory memory;
+  memory.states = (reps_up_.size() + dns_storage_.size()) * sizeof(bit_t);
+  memory.norms = norms_storage_.size() * sizeof(double);
+  memory.indices =
+      (idces_up_.size() + syms_up_.size() + ups_offset_.size()) *
+          sizeof(int64_t) +
+      (sym_limits_up_.size() + dns_limits_.size()) * sizeof(span_pair_t);
+  memory.lintables = lintable_ups_.memory() + lintable_dns_.memory();
+  memory.group_action = group_action_.memory();
+  if (n_sublat_ > 0) {
+    memory.group_action += rep_sublattice_up_.memory();
+  }
+  memory.fermi_tables = fermi_table_ups_.memory() + fermi_table_dns_.memory();
+  return memory;
+}
+
 template class BasisSymmetricNp<uint32_t>;
 template class BasisSymmetricNp<uint64_t>;
 
@@ -108,6 +141,14 @@ BasisSymmetricNpIterator<bit_t>::BasisSymmetricNpIterator(
 
   if ((basis.n_rep_ups() > 0) && begin) {
     dns_for_ups_rep_ = basis.dns_for_ups_rep(basis.rep_ups(0));
+
+    // skip leading ups representatives without any dns configuration
+    if (basis.dim() > 0) {
+      while (dns_for_ups_rep_.size() == 0) {
+        ++up_idx_;
+        dns_for_ups_rep_ = basis.dns_for_ups_rep(basis.rep_ups(up_idx_));
+      }
+    }
   }
 }
 
@@ -10,10 +10,12 @@
 #include <xdiag/common.hpp>
 
 #include <xdiag/symmetries/group_action/group_action_lookup.hpp>
+#include <xdiag/symmetries/group_action/representative_sublattice.hpp>
 #include <xdiag/symmetries/operations/group_action_operations.hpp>
 #include <xdiag/symmetries/operations/symmetry_operations.hpp>
 #include <xdiag/symmetries/permutation_group.hpp>
 #include <xdiag/symmetries/representation.hpp>
+#include <xdiag/utils/block_memory.hpp>
 
 namespace xdiag::basis::electron {
 
@@ -25,15 +27,20 @@ public:
   using iterator_t = BasisSymmetricNpIterator<bit_t>;
   using span_size_t = gsl::span<int64_t const>::size_type;
 
+  // For n_sublat > 0 the representatives of the ups are determined by
+  // sublattice coding, such that no tables over all ups are stored
   BasisSymmetricNp(int64_t n_sites, int64_t nup, int64_t ndn,
-                   PermutationGroup permutation_group, Representation irrep);
+                   PermutationGroup permutation_group, Representation irrep,
+                   int64_t n_sublat = 0);
 
   int64_t n_sites() const;
   int64_t n_up() const;
   int64_t n_dn() const;
+  int64_t n_sublat() const;
 
   int64_t dim() const;
   int64_t size() const;
+  BlockMemory memory() const;
   iterator_t begin() const;
   iterator_t end() const;
   int64_t index(bit_t ups, bit_t dns) const;
@@ -99,21 +106,37 @@ public:
 
   // Retrieving index of representative and symmetries for ups
   inline int64_t index_ups(bit_t ups) const {
-    return idces_up_[lintable_ups_.index(ups)];
+    if (n_sublat_ == 0) {
+      return idces_up_[lintable_ups_.index(ups)];
+    } else {
+      auto [rep, sym] = rep_sublattice_up_.representative_sym(ups);
+      return index_rep_ups(rep);
+    }
   }
 
   inline gsl::span<int64_t const> syms_ups(bit_t ups) const {
-    int64_t idx_ups = lintable_ups_.index(ups);
-    auto [start, length] = sym_limits_up_[idx_ups];
-    return {syms_up_.data() + start, length};
+    if (n_sublat_ == 0) {
+      int64_t idx_ups = lintable_ups_.index(ups);
+      auto [start, length] = sym_limits_up_[idx_ups];
+      return {syms_up_.data() + start, length};
+    } else {
+      auto [rep, sym] = rep_sublattice_up_.representative_sym(ups);
+      return rep_sublattice_up_.syms(index_rep_ups(rep), sym);
+    }
   }
 
   inline std::pair<int64_t, gsl::span<int64_t const>>
   index_syms_up(bit_t ups) const {
-    int64_t idx_ups = lintable_ups_.index(ups);
-    int64_t index = idces_up_[idx_ups];
-    auto [start, length] = sym_limits_up_[idx_ups];
-    return {index, {syms_up_.data() + start, length}};
+    if (n_sublat_ == 0) {
+      int64_t idx_ups = lintable_ups_.index(ups);
+      int64_t index = idces_up_[idx_ups];
+      auto [start, length] = sym_limits_up_[idx_ups];
+      return {index, {syms_up_.data() + start, length}};
+    } else {
+      auto [rep, sym] = rep_sublattice_up_.representative_sym(ups);
+      int64_t index = index_rep_ups(rep);
+      return {index, rep_sublattice_up_.syms(index, sym)};
+    }
   }
 
   // Retrieving dns states and norms for given up configuration
@@ -150,6 +173,7 @@ private:
   int64_t n_sites_;
   int64_t n_up_;
   int64_t n_dn_;
+  int64_t n_sublat_;
   GroupActionLookup<bit_t> group_action_;
   Representation irrep_;
 
@@ -165,6 +189,12 @@ private:
   std::vector<int64_t> idces_up_;
   std::vector<int64_t> syms_up_;
   std::vector<std::pair<span_size_t, span_size_t>> sym_limits_up_;
+  RepresentativeSublattice<bit_t> rep_sublattice_up_;
+
+  inline int64_t index_rep_ups(bit_t rep) const {
+    auto it = std::lower_bound(reps_up_.begin(), reps_up_.end(), rep);
+    return std::distance(reps_up_.begin(), it);
+  }
 
   std::vector<bit_t> dns_storage_;
   std::vector<double> norms_storage_;
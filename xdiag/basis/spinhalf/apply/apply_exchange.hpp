@@ -1,11 +1,10 @@
 #pragma once
 
-#include <functional>
-
 #include <xdiag/bits/bitops.hpp>
 #include <xdiag/basis/spinhalf/apply/apply_term_offdiag_no_sym.hpp>
 #include <xdiag/basis/spinhalf/apply/apply_term_offdiag_sym.hpp>
 #include <xdiag/common.hpp>
+#include <xdiag/operators/op.hpp>
 
 namespace xdiag::basis::spinhalf {
 
@@ -28,29 +27,24 @@ void apply_exchange(Op const &op, BasisIn &&basis_in, BasisOut &&basis_out,
   int64_t s2 = op[1];
   bit_t flipmask = ((bit_t)1 << s1) | ((bit_t)1 << s2);
 
-  // Define actions of op
-  auto non_zero_term = [&flipmask](bit_t spins) -> bool {
-    return bits::popcnt(spins & flipmask) & 1;
-  };
-  std::function<std::pair<bit_t, coeff_t>(bit_t)> term_action;
-
   coeff_t Jhalf = J / 2.0;
   coeff_t Jhalf_conj = xdiag::conj(Jhalf);
 
-  if constexpr (isreal<coeff_t>()) {
-    (void)Jhalf_conj;
-    term_action = [&flipmask,
-                   &Jhalf](bit_t spins) -> std::pair<bit_t, coeff_t> {
-      bit_t spins_flip = spins ^ flipmask;
+  // Define actions of op
+  auto non_zero_term = [flipmask](bit_t spins) -> bool {
+    return bits::popcnt(spins & flipmask) & 1;
+  };
+  auto term_action = [flipmask, s1, Jhalf,
+                      Jhalf_conj](bit_t spins) -> std::pair<bit_t, coeff_t> {
+    bit_t spins_flip = spins ^ flipmask;
+    if constexpr (isreal<coeff_t>()) {
+      (void)s1;
+      (void)Jhalf_conj;
       return {spins_flip, Jhalf};
-    };
-  } else {
-    term_action = [&flipmask, &s1, &Jhalf,
-                   &Jhalf_conj](bit_t spins) -> std::pair<bit_t, coeff_t> {
-      bit_t spins_flip = spins ^ flipmask;
+    } else {
       return {spins_flip, bits::gbit(spins, s1) ? Jhalf : Jhalf_conj};
-    };
-  }
+    }
+  };
 
   // Dispatch either symmetric of unsymmetric term application
   if constexpr (symmetric) {
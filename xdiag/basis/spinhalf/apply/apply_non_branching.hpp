@@ -11,14 +11,9 @@ namespace xdiag::basis::spinhalf {
 
 template <typename bit_t, typename coeff_t, bool symmetric, class BasisIn,
           class BasisOut, class Fill>
-void apply_non_branching(Op const &op, BasisIn &&basis_in,
-                         BasisOut &&basis_out, Fill &&fill) {
-
-  assert(op.ismatrix());
-  assert(operators::is_non_branching_op(op));
-
-  auto op_nb = operators::NonBranchingOp<bit_t, coeff_t>(op);
-
+void apply_non_branching(operators::NonBranchingOp<bit_t, coeff_t> const &op_nb,
+                         BasisIn &&basis_in, BasisOut &&basis_out,
+                         Fill &&fill) {
   if (op_nb.is_diagonal()) {
     auto term_coeff = [&op_nb](bit_t spins) -> coeff_t {
       bit_t local_spins = op_nb.extract_local_state(spins);
@@ -55,4 +50,15 @@ void apply_non_branching(Op const &op, BasisIn &&basis_in,
   }
 }
 
+template <typename bit_t, typename coeff_t, bool symmetric, class BasisIn,
+          class BasisOut, class Fill>
+void apply_non_branching(Op const &op, BasisIn &&basis_in,
+                         BasisOut &&basis_out, Fill &&fill) {
+  assert(op.ismatrix());
+  assert(operators::is_non_branching_op(op));
+  auto op_nb = operators::NonBranchingOp<bit_t, coeff_t>(op);
+  apply_non_branching<bit_t, coeff_t, symmetric>(op_nb, basis_in, basis_out,
+                                                 fill);
+}
+
 } // namespace xdiag::basis::spinhalf
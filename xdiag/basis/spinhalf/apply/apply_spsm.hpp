@@ -1,12 +1,10 @@
 #pragma once
 
-#include <functional>
-#include <string>
-
 #include <xdiag/bits/bitops.hpp>
 #include <xdiag/basis/spinhalf/apply/apply_term_offdiag_no_sym.hpp>
 #include <xdiag/basis/spinhalf/apply/apply_term_offdiag_sym.hpp>
 #include <xdiag/common.hpp>
+#include <xdiag/operators/op_type.hpp>
 
 namespace xdiag::basis::spinhalf {
 
@@ -27,30 +25,27 @@ void apply_spsm(Op const &op, BasisIn &&basis_in, BasisOut &&basis_out,
   bit_t mask = ((bit_t)1 << s);
 
   // Define actions of op
-  std::function<bool(bit_t)> non_zero_term;
-  std::function<std::pair<bit_t, coeff_t>(bit_t)> term_action;
-
-  if (op.type() == "S+") {
-    non_zero_term = [&mask](bit_t spins) { return !(spins & mask); };
-    term_action = [&mask, &J](bit_t spins) -> std::pair<bit_t, coeff_t> {
-      bit_t spins_flip = spins | mask;
-      return {spins_flip, J};
-    };
-  } else { // op.type() == "S-"
-    non_zero_term = [&mask](bit_t spins) { return spins & mask; };
-    term_action = [&mask, &J](bit_t spins) -> std::pair<bit_t, coeff_t> {
-      bit_t spins_flip = spins ^ mask;
-      return {spins_flip, J};
-    };
-  }
-
-  // Dispatch either symmetric of unsymmetric term application
-  if constexpr (symmetric) {
-    spinhalf::apply_term_offdiag_sym<bit_t, coeff_t>(
-        basis_in, basis_out, non_zero_term, term_action, fill);
-  } else {
-    spinhalf::apply_term_offdiag_no_sym<bit_t, coeff_t>(
-        basis_in, basis_out, non_zero_term, term_action, fill);
+  auto apply = [&](auto non_zero_term, auto term_action) {
+    // Dispatch either symmetric of unsymmetric term application
+    if constexpr (symmetric) {
+      spinhalf::apply_term_offdiag_sym<bit_t, coeff_t>(
+          basis_in, basis_out, non_zero_term, term_action, fill);
+    } else {
+      spinhalf::apply_term_offdiag_no_sym<bit_t, coeff_t>(
+          basis_in, basis_out, non_zero_term, term_action, fill);
+    }
+  };
+
+  if (op_type(op) == OpType::SPLUS) {
+    apply([mask](bit_t spins) -> bool { return !(spins & mask); },
+          [mask, J](bit_t spins) -> std::pair<bit_t, coeff_t> {
+            return {spins | mask, J};
+          });
+  } else { // OpType::SMINUS
+    apply([mask](bit_t spins) -> bool { return spins & mask; },
+          [mask, J](bit_t spins) -> std::pair<bit_t, coeff_t> {
+            return {spins ^ mask, J};
+          });
   }
 }
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <xdiag/common.hpp>
+#include <xdiag/symmetries/representation.hpp>
 #ifdef _OPENMP
 #include <xdiag/parallel/omp/omp_utils.hpp>
 #endif
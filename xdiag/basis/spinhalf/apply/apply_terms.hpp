@@ -6,39 +6,37 @@
 #include <xdiag/basis/spinhalf/apply/apply_scalar_chirality.hpp>
 #include <xdiag/basis/spinhalf/apply/apply_spsm.hpp>
 #include <xdiag/basis/spinhalf/apply/apply_sz.hpp>
+#include <xdiag/basis/spinhalf/apply/apply_terms_fused.hpp>
+#include <xdiag/basis/spinhalf/apply/compiled_terms.hpp>
 #include <xdiag/common.hpp>
+#include <xdiag/operators/op_type.hpp>
 #include <xdiag/utils/timing.hpp>
 
 namespace xdiag::basis::spinhalf {
 
 template <typename bit_t, typename coeff_t, bool symmetric, class BasisIn,
           class BasisOut, class Fill>
-void apply_terms(OpSum const &ops, BasisIn const &basis_in,
-                 BasisOut const &basis_out, Fill &fill) try {
-  for (auto op : ops) {
-
-    if (op.type() == "EXCHANGE") {
-      spinhalf::apply_exchange<bit_t, coeff_t, symmetric>(op, basis_in,
-                                                          basis_out, fill);
-    } else if (op.type() == "ISING") {
-      spinhalf::apply_ising<bit_t, coeff_t, symmetric>(op, basis_in, basis_out,
-                                                       fill);
-    } else if (op.type() == "SZ") {
-      spinhalf::apply_sz<bit_t, coeff_t, symmetric>(op, basis_in, basis_out,
-                                                    fill);
-    } else if (op.type() == "S+") {
-      spinhalf::apply_spsm<bit_t, coeff_t, symmetric>(op, basis_in, basis_out,
-                                                      fill);
-    } else if (op.type() == "S-") {
-      spinhalf::apply_spsm<bit_t, coeff_t, symmetric>(op, basis_in, basis_out,
-                                                      fill);
-    } else if (op.type() == "SCALARCHIRALITY") {
+void apply_terms(CompiledTerms<bit_t, coeff_t> const &terms,
+                 BasisIn const &basis_in, BasisOut const &basis_out,
+                 Fill &fill) try {
+
+  // Simple terms are applied in a single sweep through the basis
+  spinhalf::apply_terms_fused<bit_t, coeff_t, symmetric>(
+      terms.fused, basis_in, basis_out, fill);
+
+  for (auto const &op_nb : terms.non_branching) {
+    spinhalf::apply_non_branching<bit_t, coeff_t, symmetric>(op_nb, basis_in,
+                                                             basis_out, fill);
+  }
+
+  // All other terms are applied one by one
+  for (auto const &op : terms.other) {
+    switch (op_type(op)) {
+    case OpType::SCALARCHIRALITY:
       spinhalf::apply_scalar_chirality<bit_t, coeff_t, symmetric>(
           op, basis_in, basis_out, fill);
-    } else if (op.type() == "NONBRANCHINGOP") {
-      spinhalf::apply_non_branching<bit_t, coeff_t, symmetric>(op, basis_in,
-                                                               basis_out, fill);
-    } else {
+      break;
+    default:
       XDIAG_THROW(fmt::format(
           "Error in spinhalf::apply_terms: Unknown Op type \"{}\"", op.type()));
     }
@@ -47,4 +45,28 @@ void apply_terms(OpSum const &ops, BasisIn const &basis_in,
   XDIAG_RETHROW(e);
 }
 
+template <typename bit_t, typename coeff_t, bool symmetric, class BasisIn,
+          class BasisOut, class Fill>
+void apply_terms(CompiledTermsSpinhalf const &terms, BasisIn const &basis_in,
+                 BasisOut const &basis_out, Fill &fill) try {
+  auto terms_typed = std::get_if<CompiledTerms<bit_t, coeff_t>>(&terms);
+  if (terms_typed == nullptr) {
+    XDIAG_THROW("Compiled terms do not match the type of basis or coefficients");
+  }
+  apply_terms<bit_t, coeff_t, symmetric>(*terms_typed, basis_in, basis_out,
+                                         fill);
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+}
+
+template <typename bit_t, typename coeff_t, bool symmetric, class BasisIn,
+          class BasisOut, class Fill>
+void apply_terms(OpSum const &ops, BasisIn const &basis_in,
+                 BasisOut const &basis_out, Fill &fill) try {
+  auto terms = compiled_terms<bit_t, coeff_t>(ops);
+  apply_terms<bit_t, coeff_t, symmetric>(terms, basis_in, basis_out, fill);
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+}
+
 } // namespace xdiag::basis::spinhalf
@@ -0,0 +1,323 @@
+#pragma once
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <xdiag/algebra/apply_mode.hpp>
+#include <xdiag/basis/spinhalf/apply/apply_term_offdiag_no_sym.hpp>
+#include <xdiag/basis/spinhalf/apply/apply_term_offdiag_sym.hpp>
+#include <xdiag/bits/bitops.hpp>
+#include <xdiag/common.hpp>
+#include <xdiag/operators/op.hpp>
+#include <xdiag/operators/op_type.hpp>
+#include <xdiag/symmetries/permutation_group.hpp>
+
+#ifdef _OPENMP
+#include <xdiag/parallel/omp/omp_utils.hpp>
+#endif
+
+namespace xdiag::basis::spinhalf {
+
+// Fused application of simple spinhalf terms. Instead of sweeping through the
+// basis once per Op, all fusable terms are applied to an input state before
+// moving on to the next one. This way the input/output vectors and the basis
+// states are streamed only once per matrix-vector multiplication.
+
+enum class FusedTermType { Exchange, Ising, Sz, Sp, Sm };
+
+template <typename bit_t, typename coeff_t> struct FusedTerm {
+  FusedTermType type;
+  bit_t mask;  // sites the term acts on
+  bit_t mask1; // first site, needed for complex exchange
+  coeff_t val;
+  coeff_t val_conj;
+};
+
+inline bool is_fusable(Op const &op) {
+  switch (op_type(op)) {
+  case OpType::EXCHANGE:
+  case OpType::ISING:
+  case OpType::SZ:
+  case OpType::SPLUS:
+  case OpType::SMINUS:
+    return true;
+  default:
+    return false;
+  }
+}
+
+template <typename bit_t, typename coeff_t>
+FusedTerm<bit_t, coeff_t> fused_term(Op const &op) try {
+  assert(is_fusable(op));
+  Coupling cpl = op.coupling();
+  assert(cpl.isexplicit() && !cpl.ismatrix());
+  coeff_t J = cpl.as<coeff_t>();
+  switch (op_type(op)) {
+  case OpType::EXCHANGE: {
+    bit_t mask1 = (bit_t)1 << op[0];
+    bit_t mask = mask1 | ((bit_t)1 << op[1]);
+    coeff_t Jhalf = J / 2.0;
+    return {FusedTermType::Exchange, mask, mask1, Jhalf, xdiag::conj(Jhalf)};
+  }
+  case OpType::ISING: {
+    bit_t mask = ((bit_t)1 << op[0]) | ((bit_t)1 << op[1]);
+    return {FusedTermType::Ising, mask, 0, J / 4.0, J / 4.0};
+  }
+  case OpType::SZ: {
+    bit_t mask = (bit_t)1 << op[0];
+    return {FusedTermType::Sz, mask, 0, J / 2.0, J / 2.0};
+  }
+  case OpType::SPLUS: {
+    bit_t mask = (bit_t)1 << op[0];
+    return {FusedTermType::Sp, mask, 0, J, J};
+  }
+  case OpType::SMINUS: {
+    bit_t mask = (bit_t)1 << op[0];
+    return {FusedTermType::Sm, mask, 0, J, J};
+  }
+  default:
+    XDIAG_THROW(fmt::format("Op of type \"{}\" cannot be fused", op.type()));
+  }
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+  return FusedTerm<bit_t, coeff_t>();
+}
+
+template <typename bit_t, typename coeff_t>
+inline bool fused_term_is_diagonal(FusedTerm<bit_t, coeff_t> const &term) {
+  return (term.type == FusedTermType::Ising) ||
+         (term.type == FusedTermType::Sz);
+}
+
+template <typename bit_t, typename coeff_t>
+inline coeff_t fused_term_coeff_diag(FusedTerm<bit_t, coeff_t> const &term,
+                                     bit_t spins) {
+  if (term.type == FusedTermType::Ising) {
+    return (bits::popcnt(spins & term.mask) & 1) ? -term.val : term.val;
+  } else { // FusedTermType::Sz
+    return (spins & term.mask) ? term.val : -term.val;
+  }
+}
+
+template <typename bit_t, typename coeff_t>
+inline bool fused_term_non_zero(FusedTerm<bit_t, coeff_t> const &term,
+                                bit_t spins) {
+  switch (term.type) {
+  case FusedTermType::Exchange:
+    return bits::popcnt(spins & term.mask) & 1;
+  case FusedTermType::Sp:
+    return !(spins & term.mask);
+  case FusedTermType::Sm:
+    return spins & term.mask;
+  default: // diagonal terms
+    return true;
+  }
+}
+
+template <typename bit_t, typename coeff_t>
+inline std::pair<bit_t, coeff_t>
+fused_term_action(FusedTerm<bit_t, coeff_t> const &term, bit_t spins) {
+  switch (term.type) {
+  case FusedTermType::Exchange:
+    if constexpr (isreal<coeff_t>()) {
+      return {spins ^ term.mask, term.val};
+    } else {
+      return {spins ^ term.mask,
+              (spins & term.mask1) ? term.val : term.val_conj};
+    }
+  case FusedTermType::Sp:
+  case FusedTermType::Sm:
+    return {spins ^ term.mask, term.val};
+  default: // diagonal terms
+    return {spins, fused_term_coeff_diag(term, spins)};
+  }
+}
+
+// Orients the exchange terms consistently with respect to a symmetry group,
+// such that every symmetry maps the forward part J/2 S^+_i S^-_j of an exchange
+// term onto the forward part of another one. Then the sum of forward parts
+// commutes with the group and can be applied on a symmetric basis. Returns
+// false if this is impossible, i.e. if a symmetry maps a bond (i, j) onto
+// (j, i).
+template <typename bit_t, typename coeff_t>
+bool orient_exchange_terms(std::vector<FusedTerm<bit_t, coeff_t>> &terms,
+                           PermutationGroup const &group) {
+  auto site = [](bit_t mask) {
+    int64_t s = 0;
+    while (!((mask >> s) & 1)) {
+      ++s;
+    }
+    return s;
+  };
+  auto orbit_min = [&group](int64_t i, int64_t j) {
+    std::pair<int64_t, int64_t> m = {i, j};
+    for (int64_t sym = 0; sym < group.size(); ++sym) {
+      m = std::min(m, std::make_pair(group[sym][i], group[sym][j]));
+    }
+    return m;
+  };
+
+  for (auto &term : terms) {
+    if (term.type != FusedTermType::Exchange) {
+      continue;
+    }
+    int64_t i = site(term.mask1);
+    int64_t j = site(term.mask ^ term.mask1);
+    auto min_ij = orbit_min(i, j);
+    auto min_ji = orbit_min(j, i);
+    if (min_ij == min_ji) {
+      return false;
+    } else if (min_ji < min_ij) {
+      term.mask1 = term.mask ^ term.mask1;
+      std::swap(term.val, term.val_conj);
+    }
+  }
+  return true;
+}
+
+// Applies the forward part of an oriented exchange term to a representative
+// and fills the matrix element together with its Hermitian conjugate
+template <typename bit_t, typename coeff_t, class BasisIn, class BasisOut,
+          class Fill>
+inline void apply_exchange_half_sweep_to_spins(
+    bit_t spins_in, int64_t idx_in, FusedTerm<bit_t, coeff_t> const &term,
+    std::vector<coeff_t> const &characters, BasisIn const &basis_in,
+    BasisOut const &basis_out, Fill &fill) {
+  if ((spins_in & term.mask) == term.mask1) {
+    bit_t spins_out = spins_in ^ term.mask;
+    auto [idx_out, sym] = basis_out.index_sym(spins_out);
+    if (idx_out != invalid_index) {
+      coeff_t val = term.val * characters[sym] * basis_out.norm(idx_out) /
+                    basis_in.norm(idx_in);
+      fill(idx_in, idx_out, val);
+      fill(idx_out, idx_in, xdiag::conj(val));
+    }
+  }
+}
+
+template <typename bit_t, typename coeff_t, bool symmetric, class BasisIn,
+          class BasisOut, class Fill>
+inline void apply_terms_fused_to_spins(
+    bit_t spins_in, int64_t idx_in,
+    std::vector<FusedTerm<bit_t, coeff_t>> const &terms_diag,
+    std::vector<FusedTerm<bit_t, coeff_t>> const &terms_offdiag,
+    std::vector<FusedTerm<bit_t, coeff_t>> const &terms_half,
+    std::vector<coeff_t> const &characters, BasisIn const &basis_in,
+    BasisOut const &basis_out, Fill &fill) {
+
+  if (!terms_diag.empty()) {
+    coeff_t coeff = 0.;
+    for (auto const &term : terms_diag) {
+      coeff += fused_term_coeff_diag(term, spins_in);
+    }
+    fill(idx_in, idx_in, coeff);
+  }
+
+  if constexpr (symmetric) {
+    for (auto const &term : terms_half) {
+      apply_exchange_half_sweep_to_spins(spins_in, idx_in, term, characters,
+                                         basis_in, basis_out, fill);
+    }
+  } else {
+    (void)terms_half;
+  }
+
+  for (auto const &term : terms_offdiag) {
+    auto non_zero_term = [&term](bit_t spins) -> bool {
+      return fused_term_non_zero(term, spins);
+    };
+    auto term_action = [&term](bit_t spins) -> std::pair<bit_t, coeff_t> {
+      return fused_term_action(term, spins);
+    };
+    if constexpr (symmetric) {
+      apply_term_offdiag_sym_to_spins(spins_in, idx_in, characters, basis_in,
+                                      basis_out, non_zero_term, term_action,
+                                      fill);
+    } else {
+      (void)characters;
+      (void)basis_in;
+      apply_term_offdiag_no_sym_to_spins<bit_t, coeff_t>(
+          spins_in, idx_in, basis_out, non_zero_term, term_action, fill);
+    }
+  }
+}
+
+template <typename bit_t, typename coeff_t, bool symmetric, class BasisIn,
+          class BasisOut, class Fill>
+void apply_terms_fused(std::vector<FusedTerm<bit_t, coeff_t>> const &terms,
+                       BasisIn const &basis_in, BasisOut const &basis_out,
+                       Fill &fill) try {
+  if (terms.empty()) {
+    return;
+  }
+
+  // Diagonal terms are summed up if in/out basis agree, otherwise they are
+  // treated like any other off-diagonal term
+  std::vector<FusedTerm<bit_t, coeff_t>> terms_diag;
+  std::vector<FusedTerm<bit_t, coeff_t>> terms_offdiag;
+  bool same_basis = (basis_in == basis_out);
+  for (auto const &term : terms) {
+    if (same_basis && fused_term_is_diagonal(term)) {
+      terms_diag.push_back(term);
+    } else {
+      terms_offdiag.push_back(term);
+    }
+  }
+
+  std::vector<coeff_t> characters;
+  std::vector<FusedTerm<bit_t, coeff_t>> terms_half;
+  if constexpr (symmetric) {
+    if constexpr (iscomplex<coeff_t>()) {
+      characters = basis_out.irrep().characters();
+    } else {
+      characters = basis_out.irrep().characters_real();
+    }
+
+    // Exchange terms are applied in a Hermitian half-sweep if possible. The
+    // spin flip maps the forward onto the backward part of an exchange term,
+    // hence no consistent orientation exists with spin flip symmetry.
+    if (same_basis && hermitian_half_sweep() &&
+        !basis_in.group_action().spinflip()) {
+      std::vector<FusedTerm<bit_t, coeff_t>> terms_exchange;
+      std::vector<FusedTerm<bit_t, coeff_t>> terms_other;
+      for (auto const &term : terms_offdiag) {
+        if (term.type == FusedTermType::Exchange) {
+          terms_exchange.push_back(term);
+        } else {
+          terms_other.push_back(term);
+        }
+      }
+      if (!terms_exchange.empty() &&
+          orient_exchange_terms(
+              terms_exchange, basis_in.group_action().permutation_group())) {
+        terms_half = terms_exchange;
+        terms_offdiag = terms_other;
+      }
+    }
+  }
+
+#ifdef _OPENMP
+  int64_t size = basis_in.size();
+
+#pragma omp parallel for schedule(guided)
+  for (int64_t idx_in = 0; idx_in < size; ++idx_in) {
+    bit_t spins_in = basis_in.state(idx_in);
+    apply_terms_fused_to_spins<bit_t, coeff_t, symmetric>(
+        spins_in, idx_in, terms_diag, terms_offdiag, terms_half, characters,
+        basis_in, basis_out, fill);
+  }
+#else
+  int64_t idx_in = 0;
+  for (auto spins_in : basis_in) {
+    apply_terms_fused_to_spins<bit_t, coeff_t, symmetric>(
+        spins_in, idx_in, terms_diag, terms_offdiag, terms_half, characters,
+        basis_in, basis_out, fill);
+    ++idx_in;
+  }
+#endif
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+}
+
+} // namespace xdiag::basis::spinhalf
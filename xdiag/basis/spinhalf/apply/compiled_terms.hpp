@@ -0,0 +1,51 @@
+#pragma once
+
+#include <variant>
+#include <vector>
+
+#include <xdiag/basis/spinhalf/apply/apply_terms_fused.hpp>
+#include <xdiag/common.hpp>
+#include <xdiag/operators/non_branching_op.hpp>
+#include <xdiag/operators/op_type.hpp>
+#include <xdiag/operators/opsum.hpp>
+
+namespace xdiag::basis::spinhalf {
+
+// Compiled spinhalf terms: fusable terms are converted to masks and
+// coefficients and non-branching lookup tables are prebuilt, such that
+// they can be reused for repeated applications of the same OpSum.
+
+template <typename bit_t, typename coeff_t> struct CompiledTerms {
+  std::vector<FusedTerm<bit_t, coeff_t>> fused;
+  std::vector<operators::NonBranchingOp<bit_t, coeff_t>> non_branching;
+  OpSum other;
+};
+
+template <typename bit_t, typename coeff_t>
+CompiledTerms<bit_t, coeff_t> compiled_terms(OpSum const &ops) try {
+  CompiledTerms<bit_t, coeff_t> terms;
+  for (auto const &op : ops) {
+    if (is_fusable(op)) {
+      terms.fused.push_back(fused_term<bit_t, coeff_t>(op));
+    } else if (op_type(op) == OpType::NONBRANCHINGOP) {
+      terms.non_branching.push_back(
+          operators::NonBranchingOp<bit_t, coeff_t>(op));
+    } else {
+      terms.other += op;
+    }
+  }
+  return terms;
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+  return CompiledTerms<bit_t, coeff_t>();
+}
+
+// clang-format off
+using CompiledTermsSpinhalf = std::variant<
+  CompiledTerms<uint32_t, double>,
+  CompiledTerms<uint32_t, complex>,
+  CompiledTerms<uint64_t, double>,
+  CompiledTerms<uint64_t, complex>>;
+// clang-format on
+
+} // namespace xdiag::basis::spinhalf
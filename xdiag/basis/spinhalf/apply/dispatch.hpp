@@ -5,8 +5,9 @@
 
 namespace xdiag::basis::spinhalf {
 
-template <typename coeff_t, class fill_f>
-inline void dispatch(OpSum const &ops, Spinhalf const &block_in,
+// ops_t can either be an OpSum or precompiled CompiledTermsSpinhalf
+template <typename coeff_t, class ops_t, class fill_f>
+inline void dispatch(ops_t const &ops, Spinhalf const &block_in,
                      Spinhalf const &block_out, fill_f fill) try {
   auto const &basis_in = block_in.basis();
   auto const &basis_out = block_out.basis();
@@ -68,6 +69,10 @@ inline void dispatch(OpSum const &ops, Spinhalf const &block_in,
               BasisSublattice<uint64_t, 5> const &idx_out) {
             apply_terms<uint64_t, coeff_t, true>(ops, idx_in, idx_out, fill);
           },
+          [&](BasisSymmetricSzCompact<uint64_t> const &idx_in,
+              BasisSymmetricSzCompact<uint64_t> const &idx_out) {
+            apply_terms<uint64_t, coeff_t, true>(ops, idx_in, idx_out, fill);
+          },
 
           [&](auto const &idx_in, auto const &idx_out) {
             XDIAG_THROW("Invalid basis or combination of bases");
@@ -1,18 +1,65 @@
 #include "dispatch_apply.hpp"
 
+#include <xdiag/algebra/apply_mode.hpp>
 #include <xdiag/algebra/fill.hpp>
 #include <xdiag/basis/spinhalf/apply/dispatch.hpp>
 
 namespace xdiag::basis::spinhalf {
 
+template <typename vec_t, class ops_t>
+void dispatch_apply_vec(ops_t const &ops, Spinhalf const &block_in,
+                        arma::Col<vec_t> const &vec_in,
+                        Spinhalf const &block_out,
+                        arma::Col<vec_t> &vec_out) try {
+  using coeff_t = double_precision_t<vec_t>;
+#ifdef _OPENMP
+  if constexpr (std::is_same<coeff_t, vec_t>::value) {
+    if (apply_mode("Spinhalf") == "private") {
+      apply_private(vec_in, vec_out, [&](auto &&fill) {
+        dispatch<coeff_t>(ops, block_in, block_out, fill);
+      });
+      return;
+    }
+  }
+#endif
+  FillApply<coeff_t, vec_t> fill{vec_in.memptr(), vec_out.memptr()};
+  dispatch<coeff_t>(ops, block_in, block_out, fill);
+} catch (Error const &error) {
+  XDIAG_RETHROW(error);
+}
+
+template <typename coeff_t, class ops_t>
+void dispatch_apply_mat(ops_t const &ops, Spinhalf const &block_in,
+                        arma::Mat<coeff_t> const &mat_in,
+                        Spinhalf const &block_out,
+                        arma::Mat<coeff_t> &mat_out) try {
+#ifdef _OPENMP
+  if (apply_mode("Spinhalf") == "private") {
+    apply_private(mat_in, mat_out, [&](auto &&fill) {
+      dispatch<coeff_t>(ops, block_in, block_out, fill);
+    });
+    return;
+  }
+#endif
+  if (mat_in.n_cols > 1) {
+    apply_interleaved(mat_in, mat_out, [&](auto &&fill) {
+      dispatch<coeff_t>(ops, block_in, block_out, fill);
+    });
+    return;
+  }
+  auto fill = [&](int64_t idx_in, int64_t idx_out, coeff_t val) {
+    return fill_apply(mat_in, mat_out, idx_in, idx_out, val);
+  };
+  dispatch<coeff_t>(ops, block_in, block_out, fill);
+} catch (Error const &error) {
+  XDIAG_RETHROW(error);
+}
+
 template <typename coeff_t>
 void dispatch_apply(OpSum const &ops, Spinhalf const &block_in,
                     arma::Col<coeff_t> const &vec_in, Spinhalf const &block_out,
                     arma::Col<coeff_t> &vec_out) try {
-  auto fill = [&](int64_t idx_in, int64_t idx_out, coeff_t val) {
-    return fill_apply(vec_in, vec_out, idx_in, idx_out, val);
-  };
-  dispatch<coeff_t>(ops, block_in, block_out, fill);
+  dispatch_apply_vec(ops, block_in, vec_in, block_out, vec_out);
 } catch (Error const &error) {
   XDIAG_RETHROW(error);
 }
@@ -21,24 +68,64 @@ template <typename coeff_t>
 void dispatch_apply(OpSum const &ops, Spinhalf const &block_in,
                     arma::Mat<coeff_t> const &mat_in, Spinhalf const &block_out,
                     arma::Mat<coeff_t> &mat_out) try {
-  auto fill = [&](int64_t idx_in, int64_t idx_out, coeff_t val) {
-    return fill_apply(mat_in, mat_out, idx_in, idx_out, val);
-  };
-  dispatch<coeff_t>(ops, block_in, block_out, fill);
+  dispatch_apply_mat(ops, block_in, mat_in, block_out, mat_out);
 } catch (Error const &error) {
   XDIAG_RETHROW(error);
 }
 
+template <typename coeff_t>
+void dispatch_apply(CompiledTermsSpinhalf const &terms,
+                    Spinhalf const &block_in, arma::Col<coeff_t> const &vec_in,
+                    Spinhalf const &block_out,
+                    arma::Col<coeff_t> &vec_out) try {
+  dispatch_apply_vec(terms, block_in, vec_in, block_out, vec_out);
+} catch (Error const &error) {
+  XDIAG_RETHROW(error);
+}
+
+template <typename coeff_t>
+void dispatch_apply(CompiledTermsSpinhalf const &terms,
+                    Spinhalf const &block_in, arma::Mat<coeff_t> const &mat_in,
+                    Spinhalf const &block_out,
+                    arma::Mat<coeff_t> &mat_out) try {
+  dispatch_apply_mat(terms, block_in, mat_in, block_out, mat_out);
+} catch (Error const &error) {
+  XDIAG_RETHROW(error);
+}
 
 template void dispatch_apply(OpSum const &, Spinhalf const &, arma::vec const &,
                              Spinhalf const &block, arma::vec &);
 template void dispatch_apply(OpSum const &, Spinhalf const &,
                              arma::cx_vec const &, Spinhalf const &block,
                              arma::cx_vec &);
+template void dispatch_apply(OpSum const &, Spinhalf const &,
+                             arma::fvec const &, Spinhalf const &block,
+                             arma::fvec &);
+template void dispatch_apply(OpSum const &, Spinhalf const &,
+                             arma::cx_fvec const &, Spinhalf const &block,
+                             arma::cx_fvec &);
 template void dispatch_apply(OpSum const &, Spinhalf const &, arma::mat const &,
                              Spinhalf const &block, arma::mat &);
 template void dispatch_apply(OpSum const &, Spinhalf const &, arma::cx_mat const &,
                              Spinhalf const &block, arma::cx_mat &);
 
+template void dispatch_apply(CompiledTermsSpinhalf const &, Spinhalf const &,
+                             arma::vec const &, Spinhalf const &block,
+                             arma::vec &);
+template void dispatch_apply(CompiledTermsSpinhalf const &, Spinhalf const &,
+                             arma::cx_vec const &, Spinhalf const &block,
+                             arma::cx_vec &);
+template void dispatch_apply(CompiledTermsSpinhalf const &, Spinhalf const &,
+                             arma::fvec const &, Spinhalf const &block,
+                             arma::fvec &);
+template void dispatch_apply(CompiledTermsSpinhalf const &, Spinhalf const &,
+                             arma::cx_fvec const &, Spinhalf const &block,
+                             arma::cx_fvec &);
+template void dispatch_apply(CompiledTermsSpinhalf const &, Spinhalf const &,
+                             arma::mat const &, Spinhalf const &block,
+                             arma::mat &);
+template void dispatch_apply(CompiledTermsSpinhalf const &, Spinhalf const &,
+                             arma::cx_mat const &, Spinhalf const &block,
+                             arma::cx_mat &);
 
 } // namespace xdiag::basis::spinhalf
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <xdiag/basis/spinhalf/apply/compiled_terms.hpp>
 #include <xdiag/blocks/spinhalf.hpp>
 #include <xdiag/operators/opsum.hpp>
 
@@ -15,4 +16,14 @@ void dispatch_apply(OpSum const &ops, Spinhalf const &block_in,
                     arma::Mat<coeff_t> const &mat_in, Spinhalf const &block_out,
                     arma::Mat<coeff_t> &mat_out);
 
+template <typename coeff_t>
+void dispatch_apply(CompiledTermsSpinhalf const &terms,
+                    Spinhalf const &block_in, arma::Col<coeff_t> const &vec_in,
+                    Spinhalf const &block_out, arma::Col<coeff_t> &vec_out);
+
+template <typename coeff_t>
+void dispatch_apply(CompiledTermsSpinhalf const &terms,
+                    Spinhalf const &block_in, arma::Mat<coeff_t> const &mat_in,
+                    Spinhalf const &block_out, arma::Mat<coeff_t> &mat_out);
+
 } // namespace xdiag::basis::spinhalf
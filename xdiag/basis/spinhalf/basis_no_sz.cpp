@@ -44,6 +44,10 @@ bool BasisNoSz<bit_t>::operator!=(BasisNoSz<bit_t> const &rhs) const {
   return !operator==(rhs);
 }
 
+template <typename bit_t> BlockMemory BasisNoSz<bit_t>::memory() const {
+  return BlockMemory();
+}
+
 template class BasisNoSz<uint32_t>;
 template class BasisNoSz<uint64_t>;
 
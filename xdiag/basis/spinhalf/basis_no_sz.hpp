@@ -2,6 +2,7 @@
 
 #include <xdiag/combinatorics/subsets_index.hpp>
 #include <xdiag/common.hpp>
+#include <xdiag/utils/block_memory.hpp>
 
 namespace xdiag::basis::spinhalf {
 
@@ -17,6 +18,7 @@ public:
   iterator_t end() const;
   int64_t dim() const;
   int64_t size() const;
+  BlockMemory memory() const;
 
   inline int64_t index(bit_t spins) const { return (int64_t)spins; }
   inline bit_t state(int64_t index) const { return (bit_t)index; }
@@ -8,6 +8,9 @@ int64_t dim(BasisSpinhalf const &basis) {
 int64_t size(BasisSpinhalf const &basis) {
   return std::visit([&](auto &&b) { return b.size(); }, basis);
 }
+BlockMemory memory(BasisSpinhalf const &basis) {
+  return std::visit([&](auto &&b) { return b.memory(); }, basis);
+}
 
 template <typename bit_t> bool has_bit_t(BasisSpinhalf const &basis) try {
   return std::visit(
@@ -5,8 +5,10 @@
 #include <xdiag/basis/spinhalf/basis_sublattice.hpp>
 #include <xdiag/basis/spinhalf/basis_symmetric_no_sz.hpp>
 #include <xdiag/basis/spinhalf/basis_symmetric_sz.hpp>
+#include <xdiag/basis/spinhalf/basis_symmetric_sz_compact.hpp>
 #include <xdiag/basis/spinhalf/basis_sz.hpp>
 #include <xdiag/common.hpp>
+#include <xdiag/utils/block_memory.hpp>
 
 namespace xdiag::basis {
 
@@ -29,7 +31,8 @@ using BasisSpinhalf = std::variant<
     spinhalf::BasisSublattice<uint64_t, 2>,
     spinhalf::BasisSublattice<uint64_t, 3>,
     spinhalf::BasisSublattice<uint64_t, 4>,
-    spinhalf::BasisSublattice<uint64_t, 5>>;
+    spinhalf::BasisSublattice<uint64_t, 5>,
+    spinhalf::BasisSymmetricSzCompact<uint64_t>>;
 // clang-format on
 
 // clang-format off
@@ -44,6 +47,7 @@ using BasisSpinhalfIterator = std::variant<
 
 int64_t dim(BasisSpinhalf const &basis);
 int64_t size(BasisSpinhalf const &basis);
+BlockMemory memory(BasisSpinhalf const &basis);
 template <typename bit_t> bool has_bit_t(BasisSpinhalf const &);
 
 } // namespace xdiag::basis
@@ -115,10 +115,13 @@ compute_rep_search_range_omp(std::vector<bit_t> const &reps,
 
 template <typename bit_t, int n_sublat>
 BasisSublattice<bit_t, n_sublat>::BasisSublattice(
-    int64_t n_sites, PermutationGroup permutation_group, Representation irrep)
+    int64_t n_sites, PermutationGroup permutation_group, Representation irrep,
+    int64_t spinflip)
     : n_sites_(n_sites), sz_conserved_(false), n_up_(undefined),
       n_postfix_bits_(n_sites - std::min(maximum_prefix_bits, n_sites)),
-      group_action_(allowed_subgroup(permutation_group, irrep)), irrep_(irrep) {
+      group_action_(allowed_subgroup(permutation_group, irrep), spinflip != 0),
+      irrep_((spinflip != 0) ? spinflip_representation(irrep, spinflip)
+                             : irrep) {
   using combinatorics::Subsets;
 
   int64_t n_sites_sublat = n_sites_ / n_sublat;
@@ -137,7 +140,7 @@ BasisSublattice<bit_t, n_sublat>::BasisSublattice(
       bit_t state = (prefix << n_trailing) | postfix;
       bit_t rep = representative(state);
       if (state == rep) {
-        double norm = symmetries::norm(rep, group_action_, irrep);
+        double norm = symmetries::norm(rep, group_action_, irrep_);
         if (std::abs(norm) > 1e-6) {
           reps_.push_back(rep);
           norms_.push_back(norm);
@@ -154,10 +157,12 @@ BasisSublattice<bit_t, n_sublat>::BasisSublattice(
 template <typename bit_t, int n_sublat>
 BasisSublattice<bit_t, n_sublat>::BasisSublattice(
     int64_t n_sites, int64_t n_up, PermutationGroup permutation_group,
-    Representation irrep)
+    Representation irrep, int64_t spinflip)
     : n_sites_(n_sites), sz_conserved_(true), n_up_(n_up),
       n_postfix_bits_(n_sites - std::min(maximum_prefix_bits, n_sites)),
-      group_action_(allowed_subgroup(permutation_group, irrep)), irrep_(irrep) {
+      group_action_(allowed_subgroup(permutation_group, irrep), spinflip != 0),
+      irrep_((spinflip != 0) ? spinflip_representation(irrep, spinflip)
+                             : irrep) {
   using bits::popcnt;
 
   int64_t n_sites_sublat = n_sites_ / n_sublat;
@@ -185,7 +190,7 @@ BasisSublattice<bit_t, n_sublat>::BasisSublattice(
       bit_t state = (prefix << n_trailing) | postfix;
       bit_t rep = representative(state);
       if (state == rep) {
-        double norm = symmetries::norm(rep, group_action_, irrep);
+        double norm = symmetries::norm(rep, group_action_, irrep_);
         if (std::abs(norm) > 1e-6) {
           reps_.push_back(rep);
           norms_.push_back(norm);
@@ -213,7 +218,7 @@ BasisSublattice<bit_t, n_sublat>::BasisSublattice(
         bit_t state = (prefix << n_trailing) | postfix;
         bit_t rep = representative(state);
         if (state == rep) {
-          double norm = symmetries::norm(rep, group_action_, irrep);
+          double norm = symmetries::norm(rep, group_action_, irrep_);
           if (std::abs(norm) > 1e-6) {
             reps_thread[myid].push_back(rep);
             norms_thread[myid].push_back(norm);
@@ -344,6 +349,18 @@ bool BasisSublattice<bit_t, n_sublat>::operator!=(
   return !operator==(rhs);
 }
 
+template <typename bit_t, int n_sublat>
+BlockMemory BasisSublattice<bit_t, n_sublat>::memory() const {
+  BlockMemory memory;
+  memory.states = reps_.size() * sizeof(bit_t);
+  memory.norms = norms_.size() * sizeof(double);
+  // flat hash map entries are estimated with key, value and distance
+  memory.indices = rep_search_range_.bucket_count() *
+                   (sizeof(bit_t) + sizeof(gsl::span<bit_t const>) + 8);
+  memory.group_action = group_action_.memory();
+  return memory;
+}
+
 template class BasisSublattice<uint32_t, 1>;
 template class BasisSublattice<uint32_t, 2>;
 template class BasisSublattice<uint32_t, 3>;
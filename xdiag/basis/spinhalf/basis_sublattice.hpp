@@ -8,6 +8,7 @@
 #include <xdiag/symmetries/group_action/group_action_sublattice.hpp>
 #include <xdiag/symmetries/permutation_group.hpp>
 #include <xdiag/symmetries/representation.hpp>
+#include <xdiag/utils/block_memory.hpp>
 
 namespace xdiag::basis::spinhalf {
 
@@ -20,13 +21,15 @@ public:
 
   BasisSublattice() = default;
   BasisSublattice(int64_t n_sites, PermutationGroup permutation_group,
-                  Representation irrep);
+                  Representation irrep, int64_t spinflip = 0);
   BasisSublattice(int64_t n_sites, int64_t n_up,
-                  PermutationGroup permutation_group, Representation irrep);
+                  PermutationGroup permutation_group, Representation irrep,
+                  int64_t spinflip = 0);
 
   iterator_t begin() const;
   iterator_t end() const;
   int64_t size() const;
+  BlockMemory memory() const;
   int64_t dim() const;
 
   int64_t index(bit_t state) const;
@@ -7,22 +7,26 @@ namespace xdiag::basis::spinhalf {
 template <class bit_t>
 BasisSymmetricNoSz<bit_t>::BasisSymmetricNoSz(int64_t n_sites,
                                               PermutationGroup group,
-                                              Representation irrep)
-    : n_sites_(n_sites), group_action_(allowed_subgroup(group, irrep)),
-      irrep_(irrep), subsets_basis_(n_sites) {
+                                              Representation irrep,
+                                              int64_t spinflip)
+    : n_sites_(n_sites),
+      group_action_(allowed_subgroup(group, irrep), spinflip != 0),
+      irrep_((spinflip != 0) ? spinflip_representation(irrep, spinflip)
+                             : irrep),
+      subsets_basis_(n_sites) {
 
   if (n_sites < 0) {
     throw(std::invalid_argument("n_sites < 0"));
   } else if (n_sites != group.n_sites()) {
     throw(std::logic_error(
         "n_sites does not match the n_sites in PermutationGroup"));
-  } else if (group_action_.n_symmetries() != irrep.size()) {
+  } else if (group_action_.n_symmetries() != irrep_.size()) {
     throw(std::logic_error("PermutationGroup and Representation do not have "
                            "same number of elements"));
   }
   std::tie(reps_, index_for_rep_, syms_, sym_limits_for_rep_, norms_) =
       symmetries::representatives_indices_symmetries_limits_norms<bit_t>(
-          subsets_basis_, group_action_, irrep);
+          subsets_basis_, group_action_, irrep_);
   size_ = (int64_t)reps_.size();
 }
 
@@ -72,6 +76,18 @@ bool BasisSymmetricNoSz<bit_t>::operator!=(
   return !operator==(rhs);
 }
 
+template <typename bit_t>
+BlockMemory BasisSymmetricNoSz<bit_t>::memory() const {
+  BlockMemory memory;
+  memory.states = reps_.size() * sizeof(bit_t);
+  memory.norms = norms_.size() * sizeof(double);
+  memory.indices =
+      index_for_rep_.size() * sizeof(int64_t) + syms_.size() * sizeof(int64_t) +
+      sym_limits_for_rep_.size() * sizeof(std::pair<span_size_t, span_size_t>);
+  memory.group_action = group_action_.memory();
+  return memory;
+}
+
 template class BasisSymmetricNoSz<uint32_t>;
 template class BasisSymmetricNoSz<uint64_t>;
 
@@ -9,6 +9,7 @@
 #include <xdiag/symmetries/group_action/group_action_lookup.hpp>
 #include <xdiag/symmetries/permutation_group.hpp>
 #include <xdiag/symmetries/representation.hpp>
+#include <xdiag/utils/block_memory.hpp>
 
 namespace xdiag::basis::spinhalf {
 
@@ -20,10 +21,11 @@ public:
 
   BasisSymmetricNoSz() = default;
   BasisSymmetricNoSz(int64_t n_sites, PermutationGroup permutation_group,
-                     Representation irrep);
+                     Representation irrep, int64_t spinflip = 0);
 
   int64_t dim() const;
   int64_t size() const;
+  BlockMemory memory() const;
   iterator_t begin() const;
   iterator_t end() const;
 
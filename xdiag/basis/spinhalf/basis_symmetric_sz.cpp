@@ -1,5 +1,12 @@
 #include "basis_symmetric_sz.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+#include <xdiag/io/basis_cache.hpp>
+#include <xdiag/random/hash.hpp>
+#include <xdiag/random/hash_functions.hpp>
 #include <xdiag/symmetries/operations/representative_list.hpp>
 #include <xdiag/utils/logger.hpp>
 
@@ -8,9 +15,12 @@ namespace xdiag::basis::spinhalf {
 template <class bit_t>
 BasisSymmetricSz<bit_t>::BasisSymmetricSz(int64_t n_sites, int64_t n_up,
                                           PermutationGroup group,
-                                          Representation irrep) try
+                                          Representation irrep,
+                                          int64_t spinflip) try
     : n_sites_(n_sites), n_up_(n_up),
-      group_action_(allowed_subgroup(group, irrep)), irrep_(irrep),
+      group_action_(allowed_subgroup(group, irrep), spinflip != 0),
+      irrep_((spinflip != 0) ? spinflip_representation(irrep, spinflip)
+                             : irrep),
       combinations_indexing_(n_sites, n_up) {
   if ((n_up < 0) || (n_up > n_sites)) {
     XDIAG_THROW("Invalid value of nup");
@@ -18,16 +28,145 @@ BasisSymmetricSz<bit_t>::BasisSymmetricSz(int64_t n_sites, int64_t n_up,
     XDIAG_THROW("n_sites < 0");
   } else if (n_sites != group.n_sites()) {
     XDIAG_THROW("n_sites does not match the n_sites in PermutationGroup");
-  } else if (group_action_.n_symmetries() != irrep.size()) {
+  } else if ((spinflip != 0) && (2 * n_up != n_sites)) {
+    XDIAG_THROW("Spin flip symmetry requires n_up = n_sites / 2");
+  } else if (group_action_.n_symmetries() != irrep_.size()) {
     XDIAG_THROW("PermutationGroup and Representation do not have "
                 "same number of elements");
   }
 
-  std::tie(reps_, index_for_rep_, syms_, sym_limits_for_rep_, norms_) =
+  uint64_t hash = random::hash_fnv1((uint64_t)n_sites);
+  hash = random::hash_combine(hash, random::hash_fnv1((uint64_t)n_up));
+  hash = random::hash_combine(hash, random::hash_fnv1(sizeof(bit_t)));
+  hash = random::hash_combine(hash, random::hash(group));
+  hash = random::hash_combine(hash, random::hash(irrep_));
+  std::string filename = io::basis_cache_file("spinhalf_symmetric_sz", hash);
+  if (!filename.empty() && read_cache(filename)) {
+    return;
+  }
+
+  std::vector<int64_t> index_for_rep, syms;
+  std::vector<std::pair<span_size_t, span_size_t>> sym_limits_for_rep;
+  std::tie(reps_, index_for_rep, syms, sym_limits_for_rep, norms_) =
       symmetries::representatives_indices_symmetries_limits_norms<bit_t>(
-          combinations_indexing_, group_action_, irrep);
+          combinations_indexing_, group_action_, irrep_);
+  index_for_rep_ = SharedArray<int64_t>(std::move(index_for_rep));
+  syms_ = SharedArray<int64_t>(std::move(syms));
+  sym_limits_for_rep_ = SharedArray<std::pair<span_size_t, span_size_t>>(
+      std::move(sym_limits_for_rep));
+  size_ = (int64_t)reps_.size();
+
+  if (!filename.empty()) {
+    write_cache(filename);
+  }
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+}
 
+template <class bit_t>
+BasisSymmetricSz<bit_t>::BasisSymmetricSz(BasisSymmetricSz const &orbits,
+                                          Representation irrep) try
+    : n_sites_(orbits.n_sites_), n_up_(orbits.n_up_),
+      group_action_(orbits.group_action_), irrep_(irrep),
+      combinations_indexing_(orbits.combinations_indexing_),
+      syms_(orbits.syms_), sym_limits_for_rep_(orbits.sym_limits_for_rep_) {
+  int64_t n_symmetries = group_action_.n_symmetries();
+  if (orbits.irrep_ != trivial_representation(n_symmetries)) {
+    XDIAG_THROW("Basis to derive from must be built with the trivial "
+                "representation");
+  } else if (irrep.size() != n_symmetries) {
+    XDIAG_THROW("PermutationGroup and Representation do not have "
+                "same number of elements");
+  } else if (allowed_subgroup(group_action_.permutation_group(), irrep) !=
+             group_action_.permutation_group()) {
+    XDIAG_THROW("Representation must allow all symmetries of the "
+                "PermutationGroup to derive the basis");
+  }
+
+  // Norms of all orbits, orbits with vanishing norm are not in the basis
+  int64_t n_orbits = orbits.size_;
+  std::vector<double> norms(n_orbits);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(guided)
+#endif
+  for (int64_t idx = 0; idx < n_orbits; ++idx) {
+    norms[idx] = symmetries::norm(orbits.reps_[idx], group_action_, irrep);
+  }
+
+  std::vector<int64_t> index_for_orbit(n_orbits, invalid_index);
+  for (int64_t idx = 0; idx < n_orbits; ++idx) {
+    if (std::abs(norms[idx]) > 1e-6) {
+      index_for_orbit[idx] = (int64_t)reps_.size();
+      reps_.push_back(orbits.reps_[idx]);
+      norms_.push_back(norms[idx]);
+    }
+  }
   size_ = (int64_t)reps_.size();
+
+  int64_t size = combinations_indexing_.size();
+  std::vector<int64_t> index_for_rep(size);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (int64_t idx = 0; idx < size; ++idx) {
+    index_for_rep[idx] = index_for_orbit[orbits.index_for_rep_[idx]];
+  }
+  index_for_rep_ = SharedArray<int64_t>(std::move(index_for_rep));
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+}
+
+template <class bit_t>
+bool BasisSymmetricSz<bit_t>::read_cache(std::string const &filename) try {
+  std::ifstream f(filename);
+  if (!f.good()) {
+    return false;
+  }
+  io::BasisCacheFile file(filename);
+
+  // guard against hash collisions
+  std::vector<int64_t> parameters = {n_sites_, n_up_, (int64_t)sizeof(bit_t),
+                                     group_action_.n_symmetries()};
+  if ((file.n_arrays() != 5) ||
+      (file.parameters().size() != parameters.size() + 1) ||
+      !std::equal(parameters.begin(), parameters.end(),
+                  file.parameters().begin())) {
+    Log(1, "Basis cache file \"{}\" does not match the basis, recomputing",
+        filename);
+    return false;
+  }
+  reps_ = file.vector<bit_t>(0);
+  norms_ = file.vector<double>(1);
+  index_for_rep_ = file.array<int64_t>(2);
+  syms_ = file.array<int64_t>(3);
+  sym_limits_for_rep_ = file.array<std::pair<span_size_t, span_size_t>>(4);
+  size_ = (int64_t)reps_.size();
+  if ((size_ != file.parameters().back()) || ((int64_t)norms_.size() != size_) ||
+      (index_for_rep_.size() != combinations_indexing_.size()) ||
+      (sym_limits_for_rep_.size() != combinations_indexing_.size())) {
+    XDIAG_THROW(std::string("Invalid basis cache file \"") + filename + "\"");
+  }
+  Log(1, "Read basis from cache file \"{}\"", filename);
+  return true;
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+}
+
+template <class bit_t>
+void BasisSymmetricSz<bit_t>::write_cache(std::string const &filename) const
+    try {
+  std::vector<int64_t> parameters = {n_sites_, n_up_, (int64_t)sizeof(bit_t),
+                                     group_action_.n_symmetries(), size_};
+  io::write_basis_cache(
+      filename, parameters,
+      {{reps_.data(), (int64_t)(reps_.size() * sizeof(bit_t))},
+       {norms_.data(), (int64_t)(norms_.size() * sizeof(double))},
+       {index_for_rep_.data(), index_for_rep_.size() * (int64_t)sizeof(int64_t)},
+       {syms_.data(), syms_.size() * (int64_t)sizeof(int64_t)},
+       {sym_limits_for_rep_.data(),
+        sym_limits_for_rep_.size() *
+            (int64_t)sizeof(std::pair<span_size_t, span_size_t>)}});
+  Log(1, "Wrote basis to cache file \"{}\"", filename);
 } catch (Error const &e) {
   XDIAG_RETHROW(e);
 }
@@ -78,6 +217,19 @@ bool BasisSymmetricSz<bit_t>::operator!=(
   return !operator==(rhs);
 }
 
+template <typename bit_t>
+BlockMemory BasisSymmetricSz<bit_t>::memory() const {
+  BlockMemory memory;
+  memory.states = reps_.size() * sizeof(bit_t);
+  memory.norms = norms_.size() * sizeof(double);
+  memory.indices =
+      index_for_rep_.size() * sizeof(int64_t) + syms_.size() * sizeof(int64_t) +
+      sym_limits_for_rep_.size() * sizeof(std::pair<span_size_t, span_size_t>);
+  memory.lintables = combinations_indexing_.memory();
+  memory.group_action = group_action_.memory();
+  return memory;
+}
+
 template class BasisSymmetricSz<uint32_t>;
 template class BasisSymmetricSz<uint64_t>;
 
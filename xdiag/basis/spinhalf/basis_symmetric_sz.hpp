@@ -1,5 +1,6 @@
 #pragma once
 
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -9,9 +10,15 @@
 #include <xdiag/symmetries/group_action/group_action_lookup.hpp>
 #include <xdiag/symmetries/permutation_group.hpp>
 #include <xdiag/symmetries/representation.hpp>
+#include <xdiag/utils/block_memory.hpp>
+#include <xdiag/utils/shared_array.hpp>
 
 namespace xdiag::basis::spinhalf {
 
+// If a basis cache directory is set (see io/basis_cache.hpp), the index
+// tables are stored to / mapped from a file in this directory. A spinflip of
+// +1 or -1 additionally restricts to the sector of the global spin flip with
+// this parity, which requires n_up = n_sites / 2.
 template <typename bit_tt> class BasisSymmetricSz {
 public:
   using bit_t = bit_tt;
@@ -20,10 +27,17 @@ public:
 
   BasisSymmetricSz() = default;
   BasisSymmetricSz(int64_t n_sites, int64_t n_up,
-                   PermutationGroup permutation_group, Representation irrep);
+                   PermutationGroup permutation_group, Representation irrep,
+                   int64_t spinflip = 0);
+
+  // Derives the basis for another irrep from a basis built with the trivial
+  // representation, which contains all orbits. The symmetry tables are
+  // shared, only the norms and indices of the representatives are computed.
+  BasisSymmetricSz(BasisSymmetricSz const &orbits, Representation irrep);
 
   int64_t dim() const;
   int64_t size() const;
+  BlockMemory memory() const;
   iterator_t begin() const;
   iterator_t end() const;
 
@@ -49,13 +63,16 @@ private:
   combinatorics::CombinationsIndexing<bit_t> combinations_indexing_;
 
   std::vector<bit_t> reps_;
-  std::vector<int64_t> index_for_rep_;
-  std::vector<int64_t> syms_;
-  std::vector<std::pair<span_size_t, span_size_t>> sym_limits_for_rep_;
+  SharedArray<int64_t> index_for_rep_;
+  SharedArray<int64_t> syms_;
+  SharedArray<std::pair<span_size_t, span_size_t>> sym_limits_for_rep_;
   std::vector<double> norms_;
 
   int64_t size_;
 
+  bool read_cache(std::string const &filename);
+  void write_cache(std::string const &filename) const;
+
   // functions used in implementation of terms
 public:
   inline bit_t representative(bit_t raw_state) const {
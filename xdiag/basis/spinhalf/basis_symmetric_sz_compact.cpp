@@ -0,0 +1,115 @@
+#include "basis_symmetric_sz_compact.hpp"
+
+#include <xdiag/combinatorics/combinations_indexing.hpp>
+#include <xdiag/symmetries/operations/representative_list.hpp>
+#include <xdiag/utils/logger.hpp>
+
+namespace xdiag::basis::spinhalf {
+
+template <class bit_t>
+BasisSymmetricSzCompact<bit_t>::BasisSymmetricSzCompact(
+    int64_t n_sites, int64_t n_up, PermutationGroup group,
+    Representation irrep) try
+    : n_sites_(n_sites), n_up_(n_up),
+      group_action_(allowed_subgroup(group, irrep)), irrep_(irrep),
+      n_postfix_bits_(n_sites - n_sites / 2) {
+  if ((n_up < 0) || (n_up > n_sites)) {
+    XDIAG_THROW("Invalid value of nup");
+  } else if (n_sites < 0) {
+    XDIAG_THROW("n_sites < 0");
+  } else if (n_sites != group.n_sites()) {
+    XDIAG_THROW("n_sites does not match the n_sites in PermutationGroup");
+  } else if (group_action_.n_symmetries() != irrep.size()) {
+    XDIAG_THROW("PermutationGroup and Representation do not have "
+                "same number of elements");
+  }
+
+  // Only the representatives are stored, no index over all combinations
+  auto combinations_indexing =
+      combinatorics::CombinationsIndexing<bit_t>(n_sites, n_up);
+  std::tie(reps_, norms_) = symmetries::representatives_norms<bit_t>(
+      combinations_indexing, group_action_, irrep);
+  if (!std::is_sorted(reps_.begin(), reps_.end())) {
+    XDIAG_THROW("Representatives are not sorted");
+  }
+
+  // Compute the range of representatives for every prefix
+  int64_t n_prefixes = (int64_t)1 << (n_sites - n_postfix_bits_);
+  prefix_limits_.resize(n_prefixes + 1);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (int64_t prefix = 0; prefix < n_prefixes; ++prefix) {
+    bit_t first = (bit_t)prefix << n_postfix_bits_;
+    prefix_limits_[prefix] =
+        std::lower_bound(reps_.begin(), reps_.end(), first) - reps_.begin();
+  }
+  prefix_limits_[n_prefixes] = (int64_t)reps_.size();
+
+  size_ = (int64_t)reps_.size();
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+}
+
+template <class bit_t>
+typename std::vector<bit_t>::const_iterator
+BasisSymmetricSzCompact<bit_t>::begin() const {
+  return reps_.begin();
+}
+template <class bit_t>
+typename std::vector<bit_t>::const_iterator
+BasisSymmetricSzCompact<bit_t>::end() const {
+  return reps_.end();
+}
+
+template <class bit_t> int64_t BasisSymmetricSzCompact<bit_t>::dim() const {
+  return size_;
+}
+template <class bit_t> int64_t BasisSymmetricSzCompact<bit_t>::size() const {
+  return size_;
+}
+
+template <class bit_t>
+int64_t BasisSymmetricSzCompact<bit_t>::n_sites() const {
+  return n_sites_;
+}
+template <class bit_t> int64_t BasisSymmetricSzCompact<bit_t>::n_up() const {
+  return n_up_;
+}
+template <class bit_t>
+GroupActionLookup<bit_t> const &
+BasisSymmetricSzCompact<bit_t>::group_action() const {
+  return group_action_;
+}
+template <class bit_t>
+Representation const &BasisSymmetricSzCompact<bit_t>::irrep() const {
+  return irrep_;
+}
+
+template <typename bit_t>
+bool BasisSymmetricSzCompact<bit_t>::operator==(
+    BasisSymmetricSzCompact<bit_t> const &rhs) const {
+  return (n_sites_ == rhs.n_sites_) && (n_up_ == rhs.n_up_) &&
+         (group_action_ == rhs.group_action_) && (irrep_ == rhs.irrep_);
+}
+
+template <typename bit_t>
+bool BasisSymmetricSzCompact<bit_t>::operator!=(
+    BasisSymmetricSzCompact<bit_t> const &rhs) const {
+  return !operator==(rhs);
+}
+
+template <typename bit_t>
+BlockMemory BasisSymmetricSzCompact<bit_t>::memory() const {
+  BlockMemory memory;
+  memory.states = reps_.size() * sizeof(bit_t);
+  memory.norms = norms_.size() * sizeof(double);
+  memory.indices = prefix_limits_.size() * sizeof(int64_t);
+  memory.group_action = group_action_.memory();
+  return memory;
+}
+
+template class BasisSymmetricSzCompact<uint32_t>;
+template class BasisSymmetricSzCompact<uint64_t>;
+
+} // namespace xdiag::basis::spinhalf
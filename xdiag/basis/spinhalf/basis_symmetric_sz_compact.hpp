@@ -0,0 +1,100 @@
+#pragma once
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <xdiag/common.hpp>
+#include <xdiag/extern/gsl/span>
+#include <xdiag/symmetries/group_action/group_action_lookup.hpp>
+#include <xdiag/symmetries/operations/group_action_operations.hpp>
+#include <xdiag/symmetries/permutation_group.hpp>
+#include <xdiag/symmetries/representation.hpp>
+#include <xdiag/utils/block_memory.hpp>
+
+namespace xdiag::basis::spinhalf {
+
+// Symmetric basis with fixed n_up which only stores the (sorted)
+// representatives and their norms. Contrary to BasisSymmetricSz, no arrays
+// over the full space of binomial(n_sites, n_up) states are kept. The
+// representative of a state is computed on the fly and its index is found
+// by a binary search in the range of representatives with the same prefix.
+template <typename bit_tt> class BasisSymmetricSzCompact {
+public:
+  using bit_t = bit_tt;
+  using iterator_t = typename std::vector<bit_t>::const_iterator;
+
+  BasisSymmetricSzCompact() = default;
+  BasisSymmetricSzCompact(int64_t n_sites, int64_t n_up,
+                          PermutationGroup permutation_group,
+                          Representation irrep);
+
+  int64_t dim() const;
+  int64_t size() const;
+  BlockMemory memory() const;
+  iterator_t begin() const;
+  iterator_t end() const;
+
+  inline int64_t index(bit_t state) const {
+    return index_of_representative(representative(state));
+  }
+  inline bit_t state(int64_t idx) const { return reps_[idx]; }
+  inline double norm(int64_t idx) const { return norms_[idx]; }
+
+  int64_t n_sites() const;
+  int64_t n_up() const;
+  GroupActionLookup<bit_t> const &group_action() const;
+  Representation const &irrep() const;
+
+  bool operator==(BasisSymmetricSzCompact const &rhs) const;
+  bool operator!=(BasisSymmetricSzCompact const &rhs) const;
+
+private:
+  int64_t n_sites_;
+  int64_t n_up_;
+  GroupActionLookup<bit_t> group_action_;
+  Representation irrep_;
+
+  std::vector<bit_t> reps_;
+  std::vector<double> norms_;
+
+  // reps_[prefix_limits_[p], prefix_limits_[p+1]) have prefix p
+  int64_t n_postfix_bits_;
+  std::vector<int64_t> prefix_limits_;
+
+  int64_t size_;
+
+  inline int64_t index_of_representative(bit_t rep) const {
+    int64_t prefix = (int64_t)(rep >> n_postfix_bits_);
+    auto begin = reps_.begin() + prefix_limits_[prefix];
+    auto end = reps_.begin() + prefix_limits_[prefix + 1];
+    auto it = std::lower_bound(begin, end, rep);
+    if ((it != end) && (*it == rep)) {
+      return (int64_t)(it - reps_.begin());
+    } else {
+      return invalid_index;
+    }
+  }
+
+  // functions used in implementation of terms
+public:
+  inline bit_t representative(bit_t raw_state) const {
+    return symmetries::representative(raw_state, group_action_);
+  }
+  inline std::pair<int64_t, int64_t> index_sym(bit_t raw_state) const {
+    auto [rep, sym] = symmetries::representative_sym(raw_state, group_action_);
+    int64_t index = index_of_representative(rep);
+    if (index == invalid_index) {
+      return {invalid_index, 0};
+    }
+    return {index, sym};
+  }
+  inline std::pair<int64_t, std::vector<int64_t>>
+  index_syms(bit_t raw_state) const {
+    auto [rep, syms] =
+        symmetries::representative_syms(raw_state, group_action_);
+    return {index_of_representative(rep), syms};
+  }
+};
+
+} // namespace xdiag::basis::spinhalf
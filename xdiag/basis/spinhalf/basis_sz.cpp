@@ -58,6 +58,13 @@ bool BasisSz<bit_t>::operator!=(BasisSz<bit_t> const &rhs) const {
   return !operator==(rhs);
 }
 
+template <typename bit_t> BlockMemory BasisSz<bit_t>::memory() const {
+  BlockMemory memory;
+  memory.states = states_.size() * sizeof(bit_t);
+  memory.lintables = lintable_.memory();
+  return memory;
+}
+
 template class BasisSz<uint32_t>;
 template class BasisSz<uint64_t>;
 
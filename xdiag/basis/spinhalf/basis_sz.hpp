@@ -4,6 +4,7 @@
 #include <xdiag/combinatorics/combinations_index.hpp>
 #include <xdiag/combinatorics/lin_table.hpp>
 #include <xdiag/common.hpp>
+#include <xdiag/utils/block_memory.hpp>
 
 namespace xdiag::basis::spinhalf {
 
@@ -19,6 +20,7 @@ public:
   iterator_t end() const;
   int64_t dim() const;
   int64_t size() const;
+  BlockMemory memory() const;
 
   inline int64_t index(bit_t spins) const { return lintable_.index(spins); }
   inline bit_t state(int64_t index) const { return states_[index]; }
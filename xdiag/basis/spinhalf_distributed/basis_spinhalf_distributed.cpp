@@ -8,6 +8,9 @@ int64_t dim(BasisSpinhalfDistributed const &basis) {
 int64_t size(BasisSpinhalfDistributed const &basis) {
   return std::visit([&](auto &&b) { return b.size(); }, basis);
 }
+BlockMemory memory(BasisSpinhalfDistributed const &basis) {
+  return std::visit([&](auto &&b) { return b.memory(); }, basis);
+}
 int64_t size_max(BasisSpinhalfDistributed const &basis) {
   return std::visit([&](auto &&b) { return b.size_max(); }, basis);
 }
@@ -2,6 +2,7 @@
 #ifdef XDIAG_USE_MPI
 #include <variant>
 #include <xdiag/common.hpp>
+#include <xdiag/utils/block_memory.hpp>
 #include <xdiag/basis/spinhalf_distributed/basis_sz.hpp>
 
 namespace xdiag::basis {
@@ -20,6 +21,7 @@ using BasisSpinhalfDistributedIterator =
   
 int64_t dim(BasisSpinhalfDistributed const &basis);
 int64_t size(BasisSpinhalfDistributed const &basis);
+BlockMemory memory(BasisSpinhalfDistributed const &basis);
 int64_t size_max(BasisSpinhalfDistributed const &basis);
 int64_t size_min(BasisSpinhalfDistributed const &basis);
 
@@ -241,6 +241,30 @@ mpi::Communicator BasisSz<bit_t>::transpose_communicator(bool reverse) const {
   return reverse ? transpose_communicator_reverse_ : transpose_communicator_;
 }
 
+template <typename bit_t> BlockMemory BasisSz<bit_t>::memory() const {
+  // hash map entries are estimated with key, value and two pointers
+  int64_t map_entry_size = sizeof(bit_t) + sizeof(int64_t) + 2 * sizeof(void *);
+  BlockMemory memory;
+  memory.states = (prefixes_.size() + postfixes_.size()) * sizeof(bit_t);
+  for (auto const &states : postfix_states_) {
+    memory.states += states.size() * sizeof(bit_t);
+  }
+  for (auto const &states : prefix_states_) {
+    memory.states += states.size() * sizeof(bit_t);
+  }
+  memory.indices =
+      (prefix_begin_.size() + postfix_begin_.size()) * map_entry_size;
+  for (auto const &lintable : postfix_lintables_) {
+    memory.lintables += lintable.memory();
+  }
+  for (auto const &lintable : prefix_lintables_) {
+    memory.lintables += lintable.memory();
+  }
+  // send and receive buffer for complex coefficients
+  memory.mpi_buffers = 2 * size_max_ * sizeof(complex);
+  return memory;
+}
+
 template class BasisSz<uint32_t>;
 template class BasisSz<uint64_t>;
 
@@ -6,6 +6,7 @@
 #include <xdiag/basis/tj/apply/apply_number.hpp>
 #include <xdiag/basis/tj/apply/apply_raise_lower.hpp>
 #include <xdiag/common.hpp>
+#include <xdiag/operators/op_type.hpp>
 
 namespace xdiag::basis::tj {
 
@@ -14,20 +15,32 @@ template <typename bit_t, typename coeff_t, bool symmetric, class BasisIn,
 void apply_terms(OpSum const &ops, BasisIn const &basis_in,
                  BasisOut const &basis_out, Fill &fill) {
 
-  for (auto op : ops) {
-    std::string type = op.type();
-    if ((type == "ISING") || (type == "TJISING")) {
+  for (auto const &op : ops) {
+    switch (op_type(op)) {
+    case OpType::ISING:
+    case OpType::TJISING:
       apply_ising<bit_t, coeff_t, symmetric>(op, basis_in, fill);
-    } else if ((type == "NUMBERUP") || (type == "NUMBERDN")) {
+      break;
+    case OpType::NUMBERUP:
+    case OpType::NUMBERDN:
       apply_number<bit_t, coeff_t, symmetric>(op, basis_in, fill);
-    } else if (type == "EXCHANGE") {
+      break;
+    case OpType::EXCHANGE:
       apply_exchange<bit_t, coeff_t, symmetric>(op, basis_in, fill);
-    } else if ((type == "HOPUP") || (type == "HOPDN")) {
+      break;
+    case OpType::HOPUP:
+    case OpType::HOPDN:
       apply_hopping<bit_t, coeff_t, symmetric>(op, basis_in, fill);
-    } else if ((type == "CDAGUP") || (type == "CUP") || (type == "CDAGDN") ||
-               (type == "CDN")) {
+      break;
+    case OpType::CDAGUP:
+    case OpType::CUP:
+    case OpType::CDAGDN:
+    case OpType::CDN:
       apply_raise_lower<bit_t, coeff_t, symmetric>(op, basis_in, basis_out,
                                                    fill);
+      break;
+    default:
+      break;
     }
   }
 }
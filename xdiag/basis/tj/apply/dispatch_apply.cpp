@@ -1,17 +1,27 @@
 #include "dispatch_apply.hpp"
 
+#include <xdiag/algebra/apply_mode.hpp>
 #include <xdiag/algebra/fill.hpp>
 #include <xdiag/basis/tj/apply/dispatch.hpp>
 
 namespace xdiag::basis::tj {
 
-template <typename coeff_t>
+template <typename vec_t>
 void dispatch_apply(OpSum const &ops, tJ const &block_in,
-                    arma::Col<coeff_t> const &vec_in, tJ const &block_out,
-                    arma::Col<coeff_t> &vec_out) try {
-  auto fill = [&](int64_t idx_in, int64_t idx_out, coeff_t val) {
-    return fill_apply(vec_in, vec_out, idx_in, idx_out, val);
-  };
+                    arma::Col<vec_t> const &vec_in, tJ const &block_out,
+                    arma::Col<vec_t> &vec_out) try {
+  using coeff_t = double_precision_t<vec_t>;
+#ifdef _OPENMP
+  if constexpr (std::is_same<coeff_t, vec_t>::value) {
+    if (apply_mode("tJ") == "private") {
+      apply_private(vec_in, vec_out, [&](auto &&fill) {
+        dispatch<coeff_t>(ops, block_in, block_out, fill);
+      });
+      return;
+    }
+  }
+#endif
+  FillApply<coeff_t, vec_t> fill{vec_in.memptr(), vec_out.memptr()};
   dispatch<coeff_t>(ops, block_in, block_out, fill);
 } catch (Error const &error) {
   XDIAG_RETHROW(error);
@@ -21,14 +31,30 @@ template void dispatch_apply(OpSum const &, tJ const &, arma::vec const &,
                              tJ const &block, arma::vec &);
 template void dispatch_apply(OpSum const &, tJ const &, arma::cx_vec const &,
                              tJ const &block, arma::cx_vec &);
+template void dispatch_apply(OpSum const &, tJ const &, arma::fvec const &,
+                             tJ const &block, arma::fvec &);
+template void dispatch_apply(OpSum const &, tJ const &, arma::cx_fvec const &,
+                             tJ const &block, arma::cx_fvec &);
 
 template <typename coeff_t>
 void dispatch_apply(OpSum const &ops, tJ const &block_in,
                     arma::Mat<coeff_t> const &mat_in, tJ const &block_out,
                     arma::Mat<coeff_t> &mat_out) try {
-  auto fill = [&](int64_t idx_in, int64_t idx_out, coeff_t val) {
-    return fill_apply(mat_in, mat_out, idx_in, idx_out, val);
-  };
+#ifdef _OPENMP
+  if (apply_mode("tJ") == "private") {
+    apply_private(mat_in, mat_out, [&](auto &&fill) {
+      dispatch<coeff_t>(ops, block_in, block_out, fill);
+    });
+    return;
+  }
+#endif
+  if (mat_in.n_cols > 1) {
+    apply_interleaved(mat_in, mat_out, [&](auto &&fill) {
+      dispatch<coeff_t>(ops, block_in, block_out, fill);
+    });
+    return;
+  }
+  FillApply<coeff_t> fill{mat_in.memptr(), mat_out.memptr()};
   dispatch<coeff_t>(ops, block_in, block_out, fill);
 } catch (Error const &error) {
   XDIAG_RETHROW(error);
@@ -2,6 +2,7 @@
 
 #include <functional>
 
+#include <xdiag/algebra/fill.hpp>
 #include <xdiag/bits/bitops.hpp>
 
 namespace xdiag::basis::tj {
@@ -130,9 +131,10 @@ void generic_term_dns(BasisIn &&basis_in, BasisOut &&basis_out,
 
                 if constexpr (fermi_ups) {
                   bool fermi_up = (bool)(bits::popcnt(up_in) & 1);
-                  fill(idx_in, idx_out, fermi_up ? -coeff : coeff);
+                  fill_exclusive(fill, idx_in, idx_out,
+                                 fermi_up ? -coeff : coeff);
                 } else {
-                  fill(idx_in, idx_out, coeff);
+                  fill_exclusive(fill, idx_in, idx_out, coeff);
                 }
               }
             }
@@ -2,6 +2,7 @@
 
 #include <vector>
 
+#include <xdiag/algebra/fill.hpp>
 #include <xdiag/bits/bitops.hpp>
 
 namespace xdiag::basis::tj {
@@ -173,7 +174,7 @@ void generic_term_ups(BasisIn &&basis_in, BasisOut &&basis_out,
               bit_t dnc_out = bits::extract(dn_in, not_up_flip);
               int64_t idx_dnc_out = basis_out.index_dncs(dnc_out);
               int64_t idx_out = idx_up_flip_offset + idx_dnc_out;
-              fill(idx_in, idx_out, coeff);
+              fill_exclusive(fill, idx_in, idx_out, coeff);
             }
             ++idx_in;
           }
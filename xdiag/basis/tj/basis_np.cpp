@@ -103,6 +103,12 @@ BasisNp<bit_t>::states_indices_dncs_thread(bit_t ups) const {
 }
 #endif
 
+template <typename bit_t> BlockMemory BasisNp<bit_t>::memory() const {
+  BlockMemory memory;
+  memory.lintables = lintable_ups_.memory() + lintable_dncs_.memory();
+  return memory;
+}
+
 template class BasisNp<uint32_t>;
 template class BasisNp<uint64_t>;
 
@@ -1,6 +1,7 @@
 #include "basis_symmetric_np.hpp"
 
 #include <xdiag/combinatorics/combinations.hpp>
+#include <xdiag/symmetries/operations/representative_list.hpp>
 #include <xdiag/symmetries/operations/symmetry_operations.hpp>
 
 namespace xdiag::basis::tj {
@@ -8,8 +9,9 @@ namespace xdiag::basis::tj {
 template <typename bit_t>
 BasisSymmetricNp<bit_t>::BasisSymmetricNp(int64_t n_sites, int64_t nup,
                                           int64_t ndn, PermutationGroup group,
-                                          Representation irrep) try
-    : n_sites_(n_sites), n_up_(nup), n_dn_(ndn),
+                                          Representation irrep,
+                                          int64_t n_sublat) try
+    : n_sites_(n_sites), n_up_(nup), n_dn_(ndn), n_sublat_(n_sublat),
       group_action_(allowed_subgroup(group, irrep)), irrep_(irrep),
       raw_ups_size_(combinatorics::binomial(n_sites, nup)),
       raw_dns_size_(combinatorics::binomial(n_sites, ndn)),
@@ -30,9 +32,18 @@ BasisSymmetricNp<bit_t>::BasisSymmetricNp(int64_t n_sites, int64_t nup,
     XDIAG_THROW("n_sites does not match the n_sites in PermutationGroup");
   }
 
-  std::tie(reps_up_, idces_up_, syms_up_, sym_limits_up_) =
-      symmetries::representatives_indices_symmetries_limits<bit_t>(
-          lintable_ups_, group_action_);
+  if (n_sublat == 0) {
+    std::tie(reps_up_, idces_up_, syms_up_, sym_limits_up_) =
+        symmetries::representatives_indices_symmetries_limits<bit_t>(
+            lintable_ups_, group_action_);
+  } else {
+    auto trivial_irrep = trivial_representation(group_action_.n_symmetries());
+    reps_up_ = symmetries::representatives_norms<bit_t>(
+                   lintable_ups_, group_action_, trivial_irrep)
+                   .first;
+    rep_sublattice_up_ = RepresentativeSublattice<bit_t>(
+        n_sublat, allowed_subgroup(group, irrep), reps_up_);
+  }
 
   // if ups have trivial stabilizer, dns (compressed) are stored in front
   for (bit_t dns : Combinations<bit_t>(n_sites - nup, ndn)) {
@@ -96,6 +107,9 @@ template <typename bit_t> inline int64_t BasisSymmetricNp<bit_t>::n_up() const {
 template <typename bit_t> inline int64_t BasisSymmetricNp<bit_t>::n_dn() const {
   return n_dn_;
 }
+template <typename bit_t> int64_t BasisSymmetricNp<bit_t>::n_sublat() const {
+  return n_sublat_;
+}
 template <typename bit_t>
 GroupActionLookup<bit_t> const &BasisSymmetricNp<bit_t>::group_action() const {
   return group_action_;
@@ -213,25 +227,46 @@ std::tuple<int64_t, bool, int64_t> BasisSymmetricNp<bit_t>::index_dns_fermi_sym(
 
 // Retrieving index of representative and symmetries for ups
 template <typename bit_t>
+int64_t BasisSymmetricNp<bit_t>::index_rep_ups(bit_t rep) const {
+  auto it = std::lower_bound(reps_up_.begin(), reps_up_.end(), rep);
+  return std::distance(reps_up_.begin(), it);
+}
 
+template <typename bit_t>
 int64_t BasisSymmetricNp<bit_t>::index_ups(bit_t ups) const {
-  return idces_up_[lintable_ups_.index(ups)];
+  if (n_sublat_ == 0) {
+    return idces_up_[lintable_ups_.index(ups)];
+  } else {
+    auto [rep, sym] = rep_sublattice_up_.representative_sym(ups);
+    return index_rep_ups(rep);
+  }
 }
 
 template <typename bit_t>
 gsl::span<int64_t const> BasisSymmetricNp<bit_t>::syms_ups(bit_t ups) const {
-  int64_t idx_ups = lintable_ups_.index(ups);
-  auto [start, length] = sym_limits_up_[idx_ups];
-  return {syms_up_.data() + start, length};
+  if (n_sublat_ == 0) {
+    int64_t idx_ups = lintable_ups_.index(ups);
+    auto [start, length] = sym_limits_up_[idx_ups];
+    return {syms_up_.data() + start, length};
+  } else {
+    auto [rep, sym] = rep_sublattice_up_.representative_sym(ups);
+    return rep_sublattice_up_.syms(index_rep_ups(rep), sym);
+  }
 }
 
 template <typename bit_t>
 std::pair<int64_t, gsl::span<int64_t const>>
 BasisSymmetricNp<bit_t>::index_syms_up(bit_t ups) const {
-  int64_t idx_ups = lintable_ups_.index(ups);
-  int64_t index = idces_up_[idx_ups];
-  auto [start, length] = sym_limits_up_[idx_ups];
-  return {index, {syms_up_.data() + start, length}};
+  if (n_sublat_ == 0) {
+    int64_t idx_ups = lintable_ups_.index(ups);
+    int64_t index = idces_up_[idx_ups];
+    auto [start, length] = sym_limits_up_[idx_ups];
+    return {index, {syms_up_.data() + start, length}};
+  } else {
+    auto [rep, sym] = rep_sublattice_up_.representative_sym(ups);
+    int64_t index = index_rep_ups(rep);
+    return {index, rep_sublattice_up_.syms(index, sym)};
+  }
 }
 
 // Retrieving dns states and norms for given up configuration
@@ -278,6 +313,26 @@ int64_t BasisSymmetricNp<bit_t>::dnsc_index(bit_t dns) const {
   return lintable_dnsc_.index(dns);
 }
 
+template <typename bit_t>
+BlockMemory BasisSymmetricNp<bit_t>::memory() const {
+  using span_pair_t = std::pair<span_size_t, span_size_t>;
+  BlockMemory memory;
+  memory.states = (reps_up_.size() + dns_storage_.size()) * sizeof(bit_t);
+  memory.norms = norms_storage_.size() * sizeof(double);
+  memory.indices =
+      (idces_up_.size() + syms_up_.size() + ups_offset_.size()) *
+          sizeof(int64_t) +
+      (sym_limits_up_.size() + dns_limits_.size()) * sizeof(span_pair_t);
+  memory.lintables = lintable_ups_.memory() + lintable_dns_.memory() +
+                     lintable_dnsc_.memory();
+  memory.group_action = group_action_.memory();
+  if (n_sublat_ > 0) {
+    memory.group_action += rep_sublattice_up_.memory();
+  }
+  memory.fermi_tables = fermi_table_ups_.memory() + fermi_table_dns_.memory();
+  return memory;
+}
+
 template class BasisSymmetricNp<uint32_t>;
 template class BasisSymmetricNp<uint64_t>;
 
@@ -292,6 +347,14 @@ BasisSymmetricNpIterator<bit_t>::BasisSymmetricNpIterator(
 
   if ((basis.n_rep_ups() > 0) && begin) {
     dns_for_ups_rep_ = basis.dns_for_ups_rep(basis.rep_ups(0));
+
+    // skip leading ups representatives without any dns configuration
+    if (basis.dim() > 0) {
+      while (dns_for_ups_rep_.size() == 0) {
+        ++up_idx_;
+        dns_for_ups_rep_ = basis.dns_for_ups_rep(basis.rep_ups(up_idx_));
+      }
+    }
   }
 }
 
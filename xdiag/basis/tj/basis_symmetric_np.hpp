@@ -8,10 +8,12 @@
 #include <xdiag/common.hpp>
 #include <xdiag/extern/gsl/span>
 #include <xdiag/symmetries/group_action/group_action_lookup.hpp>
+#include <xdiag/symmetries/group_action/representative_sublattice.hpp>
 #include <xdiag/symmetries/operations/representative_list.hpp>
 #include <xdiag/symmetries/operations/symmetry_operations.hpp>
 #include <xdiag/symmetries/permutation_group.hpp>
 #include <xdiag/symmetries/representation.hpp>
+#include <xdiag/utils/block_memory.hpp>
 
 namespace xdiag::basis::tj {
 
@@ -23,15 +25,20 @@ public:
   using iterator_t = BasisSymmetricNpIterator<bit_t>;
   using span_size_t = gsl::span<int64_t const>::size_type;
 
+  // For n_sublat > 0 the representatives of the ups are determined by
+  // sublattice coding, such that no tables over all ups are stored
   BasisSymmetricNp(int64_t n_sites, int64_t nup, int64_t ndn,
-                   PermutationGroup permutation_group, Representation irrep);
+                   PermutationGroup permutation_group, Representation irrep,
+                   int64_t n_sublat = 0);
 
   int64_t n_sites() const;
   int64_t n_up() const;
   int64_t n_dn() const;
+  int64_t n_sublat() const;
 
   int64_t dim() const;
   int64_t size() const;
+  BlockMemory memory() const;
   iterator_t begin() const;
   iterator_t end() const;
   int64_t index(bit_t ups, bit_t dns) const;
@@ -43,6 +50,7 @@ private:
   int64_t n_sites_;
   int64_t n_up_;
   int64_t n_dn_;
+  int64_t n_sublat_;
   GroupActionLookup<bit_t> group_action_;
   Representation irrep_;
 
@@ -60,6 +68,8 @@ private:
   std::vector<int64_t> idces_up_;
   std::vector<int64_t> syms_up_;
   std::vector<std::pair<span_size_t, span_size_t>> sym_limits_up_;
+  RepresentativeSublattice<bit_t> rep_sublattice_up_;
+  int64_t index_rep_ups(bit_t rep) const;
 
   std::vector<int64_t> ups_offset_;
   std::vector<std::pair<span_size_t, span_size_t>> dns_limits_;
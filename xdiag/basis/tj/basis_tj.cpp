@@ -8,6 +8,9 @@ int64_t dim(BasistJ const &basis) {
 int64_t size(BasistJ const &basis) {
   return std::visit([&](auto &&b) { return b.size(); }, basis);
 }
+BlockMemory memory(BasistJ const &basis) {
+  return std::visit([&](auto &&b) { return b.memory(); }, basis);
+}
 
 template <typename bit_t> bool has_bit_t(BasistJ const &basis) try {
   return std::visit(
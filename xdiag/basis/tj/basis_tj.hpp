@@ -4,6 +4,7 @@
 #include <xdiag/basis/tj/basis_np.hpp>
 #include <xdiag/basis/tj/basis_symmetric_np.hpp>
 #include <xdiag/common.hpp>
+#include <xdiag/utils/block_memory.hpp>
 
 namespace xdiag::basis {
 
@@ -25,6 +26,7 @@ using BasistJIterator =
 
 int64_t dim(BasistJ const &basis);
 int64_t size(BasistJ const &basis);
+BlockMemory memory(BasistJ const &basis);
 template <typename bit_t> bool has_bit_t(BasistJ const &);
 
 } // namespace xdiag::basis
@@ -389,6 +389,25 @@ template void BasisNp<uint32_t>::transpose_r(const complex *, complex *) const;
 template void BasisNp<uint64_t>::transpose_r(const double *, double *) const;
 template void BasisNp<uint64_t>::transpose_r(const complex *, complex *) const;
 
+template <typename bit_t> BlockMemory BasisNp<bit_t>::memory() const {
+  // hash map entries are estimated with key, value and two pointers
+  int64_t map_entry_size = sizeof(bit_t) + sizeof(int64_t) + 2 * sizeof(void *);
+  BlockMemory memory;
+  memory.states = (my_ups_.size() + my_dns_for_ups_storage_.size() +
+                   my_dns_.size() + my_ups_for_dns_storage_.size()) *
+                  sizeof(bit_t);
+  memory.indices =
+      (my_ups_offset_.size() + my_dns_offset_.size()) * map_entry_size +
+      (my_dns_for_ups_.size() + my_ups_for_dns_.size()) *
+          sizeof(gsl::span<bit_t>) +
+      (transpose_permutation_.size() + transpose_permutation_r_.size()) *
+          sizeof(int64_t);
+  memory.lintables = lintable_dncs_.memory() + lintable_upcs_.memory();
+  // send and receive buffer for complex coefficients
+  memory.mpi_buffers = 2 * size_max_ * sizeof(complex);
+  return memory;
+}
+
 template class BasisNp<uint32_t>;
 template class BasisNp<uint64_t>;
 
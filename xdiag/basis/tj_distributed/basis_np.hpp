@@ -9,6 +9,7 @@
 #include <xdiag/extern/gsl/span>
 #include <xdiag/parallel/mpi/communicator.hpp>
 #include <xdiag/random/hash_functions.hpp>
+#include <xdiag/utils/block_memory.hpp>
 
 namespace xdiag::basis::tj_distributed {
 
@@ -29,6 +30,7 @@ public:
 
   int64_t dim() const;
   int64_t size() const;
+  BlockMemory memory() const;
   int64_t size_transpose() const;
   int64_t size_max() const;
   int64_t size_min() const;
@@ -8,6 +8,9 @@ int64_t dim(BasistJDistributed const &basis) {
 int64_t size(BasistJDistributed const &basis) {
   return std::visit([&](auto &&b) { return b.size(); }, basis);
 }
+BlockMemory memory(BasistJDistributed const &basis) {
+  return std::visit([&](auto &&b) { return b.memory(); }, basis);
+}
 int64_t size_max(BasistJDistributed const &basis) {
   return std::visit([&](auto &&b) { return b.size_max(); }, basis);
 }
@@ -3,6 +3,7 @@
 #include <variant>
 #include <xdiag/basis/tj_distributed/basis_np.hpp>
 #include <xdiag/common.hpp>
+#include <xdiag/utils/block_memory.hpp>
 
 namespace xdiag::basis {
 // clang-format off
@@ -20,6 +21,7 @@ using BasistJDistributedIterator =
   
 int64_t dim(BasistJDistributed const &basis);
 int64_t size(BasistJDistributed const &basis);
+BlockMemory memory(BasistJDistributed const &basis);
 int64_t size_max(BasistJDistributed const &basis);
 int64_t size_min(BasistJDistributed const &basis);
 
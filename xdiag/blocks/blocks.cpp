@@ -16,6 +16,10 @@ int64_t n_sites(Block const &block) {
   return std::visit([&](auto &&b) { return b.n_sites(); }, block);
 }
 
+BlockMemory memory(Block const &block) {
+  return std::visit([&](auto &&b) { return basis::memory(b.basis()); }, block);
+}
+
 bool isreal(Block const &block) {
   return std::visit([&](auto &&b) { return b.isreal(); }, block);
 }
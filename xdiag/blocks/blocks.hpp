@@ -4,6 +4,7 @@
 #include <xdiag/blocks/spinhalf.hpp>
 #include <xdiag/blocks/tj.hpp>
 #include <xdiag/common.hpp>
+#include <xdiag/utils/block_memory.hpp>
 
 #ifdef XDIAG_USE_MPI
 #include <xdiag/blocks/spinhalf_distributed.hpp>
@@ -23,6 +24,9 @@ int64_t dim(Block const &block);
 int64_t size(Block const &block);
 int64_t n_sites(Block const &block);
 
+// Memory held by the basis of a block, broken down by table type
+BlockMemory memory(Block const &block);
+
 bool isreal(Block const &block);
 
 constexpr bool isdistributed(Block const &block) {
@@ -23,6 +23,11 @@ public:
   Electron(int64_t n_sites, int64_t nup, int64_t ndn,
            PermutationGroup permutation_group, Representation irrep);
 
+  // Constructor with sublattice coding of the up spins
+  Electron(int64_t n_sites, int64_t nup, int64_t ndn,
+           PermutationGroup permutation_group, Representation irrep,
+           int64_t n_sublat);
+
   int64_t n_sites() const;
   int64_t n_up() const;
   int64_t n_dn() const;
@@ -54,26 +54,27 @@ Spinhalf::Spinhalf(int64_t n_sites, int64_t n_up) try
 template <typename bit_t>
 std::shared_ptr<Spinhalf::basis_t>
 make_spinhalf_basis_no_sz(int64_t n_sites, PermutationGroup const &group,
-                          Representation const &irrep, int64_t n_sublat) try {
+                          Representation const &irrep, int64_t n_sublat,
+                          int64_t spinflip) try {
   using basis_t = Spinhalf::basis_t;
   if (n_sublat == 0) {
     return std::make_shared<basis_t>(
-        spinhalf::BasisSymmetricNoSz<bit_t>(n_sites, group, irrep));
+        spinhalf::BasisSymmetricNoSz<bit_t>(n_sites, group, irrep, spinflip));
   } else if (n_sublat == 1) {
     return std::make_shared<basis_t>(
-        spinhalf::BasisSublattice<bit_t, 1>(n_sites, group, irrep));
+        spinhalf::BasisSublattice<bit_t, 1>(n_sites, group, irrep, spinflip));
   } else if (n_sublat == 2) {
     return std::make_shared<basis_t>(
-        spinhalf::BasisSublattice<bit_t, 2>(n_sites, group, irrep));
+        spinhalf::BasisSublattice<bit_t, 2>(n_sites, group, irrep, spinflip));
   } else if (n_sublat == 3) {
     return std::make_shared<basis_t>(
-        spinhalf::BasisSublattice<bit_t, 3>(n_sites, group, irrep));
+        spinhalf::BasisSublattice<bit_t, 3>(n_sites, group, irrep, spinflip));
   } else if (n_sublat == 4) {
     return std::make_shared<basis_t>(
-        spinhalf::BasisSublattice<bit_t, 4>(n_sites, group, irrep));
+        spinhalf::BasisSublattice<bit_t, 4>(n_sites, group, irrep, spinflip));
   } else if (n_sublat == 5) {
     return std::make_shared<basis_t>(
-        spinhalf::BasisSublattice<bit_t, 5>(n_sites, group, irrep));
+        spinhalf::BasisSublattice<bit_t, 5>(n_sites, group, irrep, spinflip));
   } else {
     XDIAG_THROW("Invalid n_sublat specified. Must be "
                 "eiter 0 (so sublattice coding) or between 1 and 5. ");
@@ -91,8 +92,17 @@ Spinhalf::Spinhalf(int64_t n_sites, PermutationGroup group,
 
 Spinhalf::Spinhalf(int64_t n_sites, PermutationGroup group,
                    Representation irrep, int64_t n_sublat) try
+    : Spinhalf(n_sites, group, irrep, n_sublat, 0) {
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+}
+
+Spinhalf::Spinhalf(int64_t n_sites, PermutationGroup group,
+                   Representation irrep, int64_t n_sublat,
+                   int64_t spinflip) try
     : n_sites_(n_sites), n_up_(undefined),
-      permutation_group_(allowed_subgroup(group, irrep)), irrep_(irrep) {
+      permutation_group_(allowed_subgroup(group, irrep)), irrep_(irrep),
+      spinflip_(spinflip) {
 
   if (n_sites < 0) {
     XDIAG_THROW("Invalid argument: n_sites < 0");
@@ -104,9 +114,11 @@ Spinhalf::Spinhalf(int64_t n_sites, PermutationGroup group,
   } else if ((n_sublat < 0) || (n_sublat > 5)) {
     XDIAG_THROW("number of sublattices must either be 0 (no "
                 "sublattice) or between 1 and 5");
+  } else if ((spinflip < -1) || (spinflip > 1)) {
+    XDIAG_THROW("spinflip must be either 0 (no spin flip), +1 or -1");
   } else if (n_sites < 64) {
-    basis_ =
-        make_spinhalf_basis_no_sz<uint64_t>(n_sites, group, irrep, n_sublat);
+    basis_ = make_spinhalf_basis_no_sz<uint64_t>(n_sites, group, irrep,
+                                                 n_sublat, spinflip);
   } else {
     XDIAG_THROW("blocks with more than 64 sites currently not implemented");
   }
@@ -120,27 +132,34 @@ template <typename bit_t>
 std::shared_ptr<Spinhalf::basis_t>
 make_spinhalf_basis_sz(int64_t n_sites, int64_t n_up,
                        PermutationGroup const &group,
-                       Representation const &irrep, int64_t n_sublat) try {
+                       Representation const &irrep, int64_t n_sublat,
+                       int64_t spinflip) try {
   using basis_t = Spinhalf::basis_t;
 
   if (n_sublat == 0) {
     return std::make_shared<basis_t>(
-        spinhalf::BasisSymmetricSz<bit_t>(n_sites, n_up, group, irrep));
+        spinhalf::BasisSymmetricSz<bit_t>(n_sites, n_up, group, irrep,
+                                          spinflip));
   } else if (n_sublat == 1) {
     return std::make_shared<basis_t>(
-        spinhalf::BasisSublattice<bit_t, 1>(n_sites, n_up, group, irrep));
+        spinhalf::BasisSublattice<bit_t, 1>(n_sites, n_up, group, irrep,
+                                              spinflip));
   } else if (n_sublat == 2) {
     return std::make_shared<basis_t>(
-        spinhalf::BasisSublattice<bit_t, 2>(n_sites, n_up, group, irrep));
+        spinhalf::BasisSublattice<bit_t, 2>(n_sites, n_up, group, irrep,
+                                              spinflip));
   } else if (n_sublat == 3) {
     return std::make_shared<basis_t>(
-        spinhalf::BasisSublattice<bit_t, 3>(n_sites, n_up, group, irrep));
+        spinhalf::BasisSublattice<bit_t, 3>(n_sites, n_up, group, irrep,
+                                              spinflip));
   } else if (n_sublat == 4) {
     return std::make_shared<basis_t>(
-        spinhalf::BasisSublattice<bit_t, 4>(n_sites, n_up, group, irrep));
+        spinhalf::BasisSublattice<bit_t, 4>(n_sites, n_up, group, irrep,
+                                              spinflip));
   } else if (n_sublat == 5) {
     return std::make_shared<basis_t>(
-        spinhalf::BasisSublattice<bit_t, 5>(n_sites, n_up, group, irrep));
+        spinhalf::BasisSublattice<bit_t, 5>(n_sites, n_up, group, irrep,
+                                              spinflip));
   } else {
     XDIAG_THROW("Invalid n_sublat specified. Must be "
                 "eiter 0 (so sublattice coding) or between 1 and 5.");
@@ -158,8 +177,17 @@ Spinhalf::Spinhalf(int64_t n_sites, int64_t n_up, PermutationGroup group,
 
 Spinhalf::Spinhalf(int64_t n_sites, int64_t n_up, PermutationGroup group,
                    Representation irrep, int64_t n_sublat) try
+    : Spinhalf(n_sites, n_up, group, irrep, n_sublat, 0) {
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+}
+
+Spinhalf::Spinhalf(int64_t n_sites, int64_t n_up, PermutationGroup group,
+                   Representation irrep, int64_t n_sublat,
+                   int64_t spinflip) try
     : n_sites_(n_sites), n_up_(n_up),
-      permutation_group_(allowed_subgroup(group, irrep)), irrep_(irrep) {
+      permutation_group_(allowed_subgroup(group, irrep)), irrep_(irrep),
+      spinflip_(spinflip) {
   if (n_sites < 0) {
     XDIAG_THROW("Invalid argument: n_sites < 0");
   } else if (n_up < 0) {
@@ -174,9 +202,13 @@ Spinhalf::Spinhalf(int64_t n_sites, int64_t n_up, PermutationGroup group,
   } else if ((n_sublat < 0) || (n_sublat > 5)) {
     XDIAG_THROW("Invalid n_sublat specified. Must be "
                 "eiter 0 (so sublattice coding) or between 1 and 5.");
+  } else if ((spinflip < -1) || (spinflip > 1)) {
+    XDIAG_THROW("spinflip must be either 0 (no spin flip), +1 or -1");
+  } else if ((spinflip != 0) && (2 * n_up != n_sites)) {
+    XDIAG_THROW("Spin flip symmetry requires n_up = n_sites / 2");
   } else if (n_sites < 64) {
-    basis_ =
-        make_spinhalf_basis_sz<uint64_t>(n_sites, n_up, group, irrep, n_sublat);
+    basis_ = make_spinhalf_basis_sz<uint64_t>(n_sites, n_up, group, irrep,
+                                              n_sublat, spinflip);
   } else {
     XDIAG_THROW("blocks with more than 64 sites currently not implemented");
   }
@@ -186,6 +218,79 @@ Spinhalf::Spinhalf(int64_t n_sites, int64_t n_up, PermutationGroup group,
   XDIAG_RETHROW(e);
 }
 
+Spinhalf::Spinhalf(int64_t n_sites, int64_t n_up, PermutationGroup group,
+                   Representation irrep, std::string backend) try
+    : n_sites_(n_sites), n_up_(n_up),
+      permutation_group_(allowed_subgroup(group, irrep)), irrep_(irrep) {
+  if (n_sites < 0) {
+    XDIAG_THROW("Invalid argument: n_sites < 0");
+  } else if (n_up < 0) {
+    XDIAG_THROW("Invalid argument: n_up < 0");
+  } else if (n_up > n_sites) {
+    XDIAG_THROW("Invalid argument: n_up > n_sites");
+  } else if (n_sites != group.n_sites()) {
+    XDIAG_THROW("n_sites does not match the n_sites in PermutationGroup");
+  } else if (permutation_group_.size() != irrep.size()) {
+    XDIAG_THROW("PermutationGroup and Representation do not have "
+                "same number of elements");
+  } else if (n_sites >= 64) {
+    XDIAG_THROW("blocks with more than 64 sites currently not implemented");
+  }
+
+  if (backend == "lookup") {
+    basis_ =
+        make_spinhalf_basis_sz<uint64_t>(n_sites, n_up, group, irrep, 0, 0);
+  } else if (backend == "compact") {
+    basis_ = std::make_shared<basis_t>(spinhalf::BasisSymmetricSzCompact<
+                                       uint64_t>(n_sites, n_up, group, irrep));
+  } else {
+    XDIAG_THROW("Invalid backend specified. Must be "
+                "either \"lookup\" or \"compact\".");
+  }
+  size_ = basis::size(*basis_);
+  check_dimension_works_with_blas_int_size(size_);
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+}
+
+std::vector<Spinhalf>
+spinhalf_blocks(int64_t n_sites, int64_t n_up,
+                PermutationGroup const &group,
+                std::vector<Representation> const &irreps) try {
+  using basis_t = Spinhalf::basis_t;
+  using basis_sym_t = spinhalf::BasisSymmetricSz<uint64_t>;
+
+  std::vector<Spinhalf> blocks;
+  std::shared_ptr<basis_t> orbits;
+  for (auto const &irrep : irreps) {
+    // irreps not allowing all symmetries are built separately
+    if ((irrep.size() != group.size()) ||
+        (allowed_subgroup(group, irrep) != group)) {
+      blocks.push_back(Spinhalf(n_sites, n_up, group, irrep));
+      continue;
+    }
+
+    if (!orbits) {
+      orbits =
+          Spinhalf(n_sites, n_up, group, trivial_representation(group)).basis_;
+    }
+    auto const &orbits_basis = std::get<basis_sym_t>(*orbits);
+
+    Spinhalf block;
+    block.n_sites_ = n_sites;
+    block.n_up_ = n_up;
+    block.permutation_group_ = group;
+    block.irrep_ = irrep;
+    block.basis_ = std::make_shared<basis_t>(basis_sym_t(orbits_basis, irrep));
+    block.size_ = basis::size(*block.basis_);
+    check_dimension_works_with_blas_int_size(block.size_);
+    blocks.push_back(block);
+  }
+  return blocks;
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+}
+
 int64_t Spinhalf::n_sites() const { return n_sites_; }
 int64_t Spinhalf::n_up() const { return n_up_; }
 
@@ -193,6 +298,7 @@ PermutationGroup Spinhalf::permutation_group() const {
   return permutation_group_;
 }
 Representation Spinhalf::irrep() const { return irrep_; }
+int64_t Spinhalf::spinflip() const { return spinflip_; }
 
 int64_t Spinhalf::dim() const { return size_; }
 int64_t Spinhalf::size() const { return size_; }
@@ -217,7 +323,8 @@ bool Spinhalf::isreal(double precision) const {
 bool Spinhalf::operator==(Spinhalf const &rhs) const {
   return (n_sites_ == rhs.n_sites_) && (n_up_ == rhs.n_up_) &&
          (permutation_group_ == rhs.permutation_group_) &&
-         (irrep_ == rhs.irrep_) && (*basis_ == *rhs.basis_);
+         (irrep_ == rhs.irrep_) && (spinflip_ == rhs.spinflip_) &&
+         (*basis_ == *rhs.basis_);
 }
 
 bool Spinhalf::operator!=(Spinhalf const &rhs) const {
@@ -240,6 +347,9 @@ std::ostream &operator<<(std::ostream &out, Spinhalf const &block) {
     out << "  irrep    : defined with ID " << std::hex
         << random::hash(block.irrep()) << std::dec << "\n";
   }
+  if (block.spinflip() != 0) {
+    out << "  spinflip : " << block.spinflip() << "\n";
+  }
   std::stringstream ss;
   ss.imbue(std::locale("en_US.UTF-8"));
   ss << block.size();
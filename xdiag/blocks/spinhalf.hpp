@@ -1,6 +1,8 @@
 #pragma once
 
 #include <memory>
+#include <string>
+#include <vector>
 
 #include <xdiag/basis/spinhalf/basis_spinhalf.hpp>
 #include <xdiag/common.hpp>
@@ -28,13 +30,29 @@ public:
   // Constructors with sublattice coding
   Spinhalf(int64_t n_sites, PermutationGroup permutation_group,
            Representation irrep, int64_t n_sublat);
+
+  // Constructor selecting how symmetric states are indexed. The backend
+  // "lookup" (default) stores index tables over all binomial(n_sites, n_up)
+  // states, "compact" only stores the representatives and computes the index
+  // of a state on the fly, which needs about n_symmetries times less memory.
+  Spinhalf(int64_t n_sites, int64_t n_up, PermutationGroup permutation_group,
+           Representation irrep, std::string backend);
   Spinhalf(int64_t n_sites, int64_t n_up, PermutationGroup permutation_group,
            Representation irrep, int64_t n_sublat);
 
+  // Constructors additionally using the global spin flip symmetry, where
+  // spinflip is the parity (+1 or -1) of the states under the spin flip. With
+  // conserved n_up this requires n_up = n_sites / 2.
+  Spinhalf(int64_t n_sites, PermutationGroup permutation_group,
+           Representation irrep, int64_t n_sublat, int64_t spinflip);
+  Spinhalf(int64_t n_sites, int64_t n_up, PermutationGroup permutation_group,
+           Representation irrep, int64_t n_sublat, int64_t spinflip);
+
   int64_t n_sites() const;
   int64_t n_up() const;
   PermutationGroup permutation_group() const;
   Representation irrep() const;
+  int64_t spinflip() const;
 
   int64_t dim() const;
   int64_t size() const;
@@ -48,16 +66,29 @@ public:
 
   basis_t const &basis() const;
 
+  friend std::vector<Spinhalf>
+  spinhalf_blocks(int64_t n_sites, int64_t n_up,
+                  PermutationGroup const &permutation_group,
+                  std::vector<Representation> const &irreps);
+
 private:
   int64_t n_sites_;
   int64_t n_up_;
   PermutationGroup permutation_group_;
   Representation irrep_;
+  int64_t spinflip_ = 0;
 
   std::shared_ptr<basis_t> basis_;
   int64_t size_;
 };
 
+// Creates the symmetric blocks of several irreps of one permutation group.
+// The orbits of the group are only enumerated once and the symmetry tables
+// are shared among all blocks.
+std::vector<Spinhalf> spinhalf_blocks(int64_t n_sites, int64_t n_up,
+                                      PermutationGroup const &permutation_group,
+                                      std::vector<Representation> const &irreps);
+
 std::ostream &operator<<(std::ostream &out, Spinhalf const &block);
 std::string to_string(Spinhalf const &block);
 
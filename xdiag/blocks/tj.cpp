@@ -33,6 +33,13 @@ tJ::tJ(int64_t n_sites, int64_t nup, int64_t ndn) try
 
 tJ::tJ(int64_t n_sites, int64_t nup, int64_t ndn, PermutationGroup group,
        Representation irrep) try
+    : tJ(n_sites, nup, ndn, group, irrep, 0) {
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+}
+
+tJ::tJ(int64_t n_sites, int64_t nup, int64_t ndn, PermutationGroup group,
+       Representation irrep, int64_t n_sublat) try
     : n_sites_(n_sites), n_up_(nup), n_dn_(ndn),
       permutation_group_(allowed_subgroup(group, irrep)), irrep_(irrep) {
 
@@ -47,12 +54,15 @@ tJ::tJ(int64_t n_sites, int64_t nup, int64_t ndn, PermutationGroup group,
   } else if (permutation_group_.size() != irrep.size()) {
     XDIAG_THROW("PermutationGroup and Representation do not have "
                 "same number of elements");
-  } else if (n_sites < 32) {
+  } else if ((n_sublat < 0) || (n_sublat > 5)) {
+    XDIAG_THROW("Invalid n_sublat specified. Must be "
+                "either 0 (no sublattice coding) or between 1 and 5.");
+  } else if ((n_sites < 32) && (n_sublat == 0)) {
     basis_ = std::make_shared<basis_t>(
         tj::BasisSymmetricNp<uint32_t>(n_sites, nup, ndn, group, irrep));
   } else if (n_sites < 64) {
-    basis_ = std::make_shared<basis_t>(
-        tj::BasisSymmetricNp<uint64_t>(n_sites, nup, ndn, group, irrep));
+    basis_ = std::make_shared<basis_t>(tj::BasisSymmetricNp<uint64_t>(
+        n_sites, nup, ndn, group, irrep, n_sublat));
   } else {
     XDIAG_THROW("blocks with more than 64 sites currently not implemented");
   }
@@ -19,6 +19,11 @@ public:
   tJ(int64_t n_sites, int64_t nup, int64_t ndn,
      PermutationGroup permutation_group, Representation irrep);
 
+  // Constructor with sublattice coding of the up spins
+  tJ(int64_t n_sites, int64_t nup, int64_t ndn,
+     PermutationGroup permutation_group, Representation irrep,
+     int64_t n_sublat);
+
   int64_t n_sites() const;
   int64_t n_up() const;
   int64_t n_dn() const;
@@ -18,6 +18,7 @@ public:
     return combinatorics::get_nth_pattern<bit_t>(idx, n_, k_);
   }
   inline int64_t size() const { return size_; }
+  inline int64_t memory() const { return lin_table_.memory(); } // in bytes
 
   inline combinatorics::Combinations<bit_t> states() const {
     return combinatorics::Combinations<bit_t>(n_, k_);
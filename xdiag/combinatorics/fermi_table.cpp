@@ -1,112 +1,90 @@
 #include "fermi_table.hpp"
 
-#include <cassert>
-
-#include <xdiag/combinatorics/combinations.hpp>
-#include <xdiag/combinatorics/subsets.hpp>
-#include <xdiag/symmetries/operations/fermi_sign.hpp>
-
-#ifdef _OPENMP
-#include <xdiag/parallel/omp/omp_utils.hpp>
-#endif
-
 namespace xdiag::combinatorics {
 
-template <class States>
-std::vector<bool> init_fermi_table_serial(States const &states,
-                                          PermutationGroup const &group) {
-  int64_t n_sites = group.n_sites();
-  int64_t n_symmetries = group.n_symmetries();
-  int64_t raw_size = states.size();
-  std::vector<bool> fermi_table(raw_size * n_symmetries);
-  auto fermi_work = symmetries::fermi_work(n_sites);
-  for (int64_t sym = 0; sym < n_symmetries; ++sym) {
-    auto const &perm = group[sym];
-
-    int64_t idx = 0;
-    for (auto state : states) {
-      fermi_table[sym * raw_size + idx] =
-          symmetries::fermi_bool_of_permutation(state, perm, fermi_work);
-      ++idx;
+// Parity of the number of pairs of fermions on sites i < j with
+// perm[i] > perm[j]
+template <typename bit_t>
+static bool fermi_bool(bit_t state, Permutation const &perm) {
+  bool fermi = false;
+  bit_t images = 0; // images of the fermions on lower sites
+  for (int64_t site = 0; site < perm.size(); ++site) {
+    if ((state >> site) & 1) {
+      bit_t image = (bit_t)1 << perm[site];
+      bit_t above = (bit_t)~((image - 1) | image);
+      fermi ^= bits::popcnt((bit_t)(images & above)) & 1;
+      images |= image;
     }
   }
-  return fermi_table;
+  return fermi;
 }
 
-#ifdef _OPENMP
-template <class States>
-std::vector<bool> init_fermi_table_omp(States const &states,
-                                       PermutationGroup const &group) {
-  int64_t n_sites = group.n_sites();
+template <typename bit_t>
+FermiTableSubsets<bit_t>::FermiTableSubsets(int64_t n_sites,
+                                            PermutationGroup const &group) try
+    : n_sites_(n_sites), n_prefix_bits_(n_sites / 2),
+      n_postfix_bits_(n_sites - n_prefix_bits_),
+      postfix_mask_(((bit_t)1 << n_postfix_bits_) - 1) {
+  if (n_sites < 0) {
+    XDIAG_THROW("n_sites < 0");
+  } else if (n_sites > (int64_t)(8 * sizeof(bit_t))) {
+    XDIAG_THROW("n_sites too large for the chosen integer type");
+  } else if (n_sites != group.n_sites()) {
+    XDIAG_THROW("n_sites does not match the n_sites in PermutationGroup");
+  }
   int64_t n_symmetries = group.n_symmetries();
-  int64_t raw_size = states.size();
-  std::vector<bool> fermi_bool_table;
-  fermi_bool_table.reserve(raw_size * n_symmetries);
-
-  for (int64_t sym = 0; sym < n_symmetries; ++sym) {
-    auto const &perm = group[sym];
-    std::vector<std::vector<bool>> fermi_bool_table_local;
-
-    // Comment: even though every entry in fermi_bool_table would be
-    // written by only one thread, std::vector<bool> is special and requires
-    // seperate vectors to be built
-    
-#pragma omp parallel
-    {
-      int myid = omp_get_thread_num();
-      int rank = omp_get_num_threads();
-
-#pragma omp single
-      { fermi_bool_table_local.resize(rank); }
-#pragma omp barrier
-
-      auto states_thread = ThreadStates(states);
-      // fermi_bool_table_local[myid].resize(states_thread.size());
-      auto fermi_work = symmetries::fermi_work(n_sites);
-      for (auto state : states_thread) {
-        bool fermi_bool =
-            symmetries::fermi_bool_of_permutation(state, perm, fermi_work);
-        fermi_bool_table_local[myid].push_back(fermi_bool);
-      }
-#pragma omp barrier
+  int64_t prefix_size = (int64_t)1 << n_prefix_bits_;
+  int64_t postfix_size = (int64_t)1 << n_postfix_bits_;
 
-#pragma omp single
-      {
-        for (int id = 0; id < rank; ++id) {
-          fermi_bool_table.insert(fermi_bool_table.end(),
-                                  fermi_bool_table_local[id].begin(),
-                                  fermi_bool_table_local[id].end());
-        }
-      }
-
-    } // pragma omp parallel
-  }
+  prefix_image_.resize(n_symmetries * prefix_size);
+  prefix_sign_.resize(n_symmetries * prefix_size);
+  postfix_exchange_.resize(n_symmetries * postfix_size);
+  postfix_sign_.resize(n_symmetries * postfix_size);
 
-  return fermi_bool_table;
-}
+  // Permuted prefix and sign of the inversions within the prefix
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
 #endif
+  for (int64_t idx = 0; idx < n_symmetries * prefix_size; ++idx) {
+    auto const &perm = group[idx / prefix_size];
+    bit_t prefix = (bit_t)(idx % prefix_size) << n_postfix_bits_;
+    prefix_image_[idx] = perm.apply(prefix);
+    prefix_sign_[idx] = fermi_bool(prefix, perm);
+  }
 
-template <class States>
-std::vector<bool> init_fermi_table(States const &states,
-                                   PermutationGroup const &group) {
-  assert(states.n() == group.n_sites());
+  // Sign of the inversions within the postfix and the exchange mask, whose
+  // bit b is set if an odd number of postfix fermions are mapped above b
 #ifdef _OPENMP
-  return init_fermi_table_omp(states, group);
-#else
-  return init_fermi_table_serial(states, group);
+#pragma omp parallel for schedule(static)
 #endif
+  for (int64_t idx = 0; idx < n_symmetries * postfix_size; ++idx) {
+    auto const &perm = group[idx / postfix_size];
+    bit_t postfix = (bit_t)(idx % postfix_size);
+    bit_t exchange = 0;
+    for (int64_t site = 0; site < n_postfix_bits_; ++site) {
+      if ((postfix >> site) & 1) {
+        exchange ^= ((bit_t)1 << perm[site]) - 1;
+      }
+    }
+    postfix_exchange_[idx] = exchange;
+    postfix_sign_[idx] = fermi_bool(postfix, perm);
+  }
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
 }
 
-template <typename bit_t>
-FermiTableSubsets<bit_t>::FermiTableSubsets(int64_t n_sites,
-                                            PermutationGroup const &group)
-    : n_sites_(n_sites),
-      table_(init_fermi_table(combinatorics::Subsets<bit_t>(n_sites), group)) {}
+template <typename bit_t> int64_t FermiTableSubsets<bit_t>::memory() const {
+  return (prefix_image_.size() + postfix_exchange_.size()) * sizeof(bit_t) +
+         (prefix_sign_.size() + postfix_sign_.size()) * sizeof(uint8_t);
+}
 
 template <typename bit_t>
 bool FermiTableSubsets<bit_t>::operator==(
     FermiTableSubsets<bit_t> const &rhs) const {
-  return (n_sites_ == rhs.n_sites_) && (table_ == rhs.table_);
+  return (n_sites_ == rhs.n_sites_) && (prefix_image_ == rhs.prefix_image_) &&
+         (prefix_sign_ == rhs.prefix_sign_) &&
+         (postfix_exchange_ == rhs.postfix_exchange_) &&
+         (postfix_sign_ == rhs.postfix_sign_);
 }
 
 template <typename bit_t>
@@ -121,17 +99,24 @@ template class FermiTableSubsets<uint64_t>;
 
 template <typename bit_t>
 FermiTableCombinations<bit_t>::FermiTableCombinations(
-    int64_t n_sites, int64_t n_par, PermutationGroup const &group)
-    : raw_size_(combinatorics::binomial(n_sites, n_par)),
-      lin_table_(n_sites, n_par),
-      table_(init_fermi_table(
-          combinatorics::Combinations<bit_t>(n_sites, n_par), group)) {}
+    int64_t n_sites, int64_t n_par, PermutationGroup const &group) try
+    : n_par_(n_par), table_(n_sites, group) {
+  if ((n_par < 0) || (n_par > n_sites)) {
+    XDIAG_THROW("Invalid number of particles");
+  }
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+}
+
+template <typename bit_t>
+int64_t FermiTableCombinations<bit_t>::memory() const {
+  return table_.memory();
+}
 
 template <typename bit_t>
 bool FermiTableCombinations<bit_t>::operator==(
     FermiTableCombinations<bit_t> const &rhs) const {
-  return (raw_size_ == rhs.raw_size_) && (lin_table_ == rhs.lin_table_) &&
-         (table_ == rhs.table_);
+  return (n_par_ == rhs.n_par_) && (table_ == rhs.table_);
 }
 template <typename bit_t>
 bool FermiTableCombinations<bit_t>::operator!=(
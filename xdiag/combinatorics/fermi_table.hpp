@@ -2,44 +2,69 @@
 
 #include <vector>
 
+#include <xdiag/bits/popcnt.hpp>
 #include <xdiag/combinatorics/combinations.hpp>
-#include <xdiag/combinatorics/lin_table.hpp>
 #include <xdiag/combinatorics/subsets.hpp>
 #include <xdiag/common.hpp>
 #include <xdiag/symmetries/permutation_group.hpp>
 
 namespace xdiag::combinatorics {
 
+// Fermi signs of the permutations in a group acting on arbitrary states.
+//
+// A state is split into a prefix (upper n_sites/2 bits) and a postfix (lower
+// bits), as in GroupActionLookup. The sign is the parity of the inversions
+// within the prefix, within the postfix and between prefix and postfix
+// fermions. The first two are tabulated, the latter is the parity of the
+// overlap of the permuted prefix with a mask tabulated for every postfix.
+// Hence, only tables of size n_symmetries * 2^(n_sites/2) are stored.
 template <typename bit_t = std_bit_t> class FermiTableSubsets {
 public:
   FermiTableSubsets() = default;
   FermiTableSubsets(int64_t n_sites, PermutationGroup const &group);
   inline bool sign(int64_t sym, bit_t state) const {
-    return table_[(sym << n_sites_) | (int64_t)state];
+    int64_t idx_prefix =
+        (sym << n_prefix_bits_) | (int64_t)(state >> n_postfix_bits_);
+    int64_t idx_postfix =
+        (sym << n_postfix_bits_) | (int64_t)(state & postfix_mask_);
+    bit_t exchanged =
+        prefix_image_[idx_prefix] & postfix_exchange_[idx_postfix];
+    return (prefix_sign_[idx_prefix] ^ postfix_sign_[idx_postfix]) ^
+           (bits::popcnt(exchanged) & 1);
   }
+  int64_t memory() const; // memory of the tables in bytes
   bool operator==(FermiTableSubsets const &rhs) const;
   bool operator!=(FermiTableSubsets const &rhs) const;
 
 private:
   int64_t n_sites_;
-  std::vector<bool> table_;
+  int64_t n_prefix_bits_;
+  int64_t n_postfix_bits_;
+  bit_t postfix_mask_;
+
+  std::vector<bit_t> prefix_image_;
+  std::vector<uint8_t> prefix_sign_;
+  std::vector<bit_t> postfix_exchange_;
+  std::vector<uint8_t> postfix_sign_;
 };
 
+// Fermi signs for states with a fixed number of particles. The tables do not
+// depend on the number of particles, see FermiTableSubsets.
 template <typename bit_t = std_bit_t> class FermiTableCombinations {
 public:
   FermiTableCombinations() = default;
   FermiTableCombinations(int64_t n_sites, int64_t n_par,
                          PermutationGroup const &group);
   inline bool sign(int64_t sym, bit_t state) const {
-    return table_[sym * raw_size_ + lin_table_.index(state)];
+    return table_.sign(sym, state);
   }
+  int64_t memory() const; // memory of the tables in bytes
   bool operator==(FermiTableCombinations const &rhs) const;
   bool operator!=(FermiTableCombinations const &rhs) const;
 
 private:
-  int64_t raw_size_;
-  combinatorics::LinTable<bit_t> lin_table_;
-  std::vector<bool> table_;
+  int64_t n_par_;
+  FermiTableSubsets<bit_t> table_;
 };
 
 } // namespace xdiag::combinatorics
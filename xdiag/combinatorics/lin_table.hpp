@@ -30,6 +30,10 @@ public:
     return combinatorics::CombinationsIndex<bit_t>(n_, k_);
   }
   inline int64_t size() const { return size_; }
+  inline int64_t memory() const { // in bytes
+    return (int64_t)((left_indices_.size() + right_indices_.size()) *
+                     sizeof(int64_t));
+  }
 
   bool operator==(LinTable<bit_t> const &rhs) const;
   bool operator!=(LinTable<bit_t> const &rhs) const;
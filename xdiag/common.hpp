@@ -37,6 +37,15 @@ template <class coeff_t> struct complex_type_struct<std::complex<coeff_t>> {
   typedef std::complex<coeff_t> type;
 };
 
+template <class coeff_t> struct double_precision_type_struct {
+  typedef double type;
+};
+
+template <class coeff_t>
+struct double_precision_type_struct<std::complex<coeff_t>> {
+  typedef std::complex<double> type;
+};
+
 } // namespace xdiag::detail
 
 namespace xdiag {
@@ -71,6 +80,11 @@ using real_t = typename detail::real_type_struct<coeff_t>::type;
 template <class coeff_t>
 using complex_t = typename detail::complex_type_struct<coeff_t>::type;
 
+// double or complex double, the type matrix elements are computed in
+template <class coeff_t>
+using double_precision_t =
+    typename detail::double_precision_type_struct<coeff_t>::type;
+
 inline float real(float x) { return x; }
 inline double real(double x) { return x; }
 inline float real(std::complex<float> x) { return x.real(); }
@@ -0,0 +1,10 @@
+#pragma once
+
+#define XDIAG_VERSION "0.2.2"
+#define XDIAG_DIRECTORY "/root/repo"
+#define XDIAG_HOSTNAME "vm"
+#define XDIAG_COMPILEDBY "root"
+
+namespace xdiag {
+inline const char *git_hash() { return "1232987e0a756cf40d97cdd85b8ecbb7110bad4f"; }
+} // namespace xdiag
@@ -0,0 +1,158 @@
+#include "basis_cache.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace xdiag {
+
+static std::string basis_cache_dir = "";
+
+void set_basis_cache_directory(std::string const &directory) {
+  basis_cache_dir = directory;
+}
+std::string basis_cache_directory() { return basis_cache_dir; }
+
+namespace io {
+
+static constexpr uint64_t basis_cache_magic = 0x3143424741494458; // XDIAGBC1
+static constexpr int64_t basis_cache_version = 1;
+
+static int64_t aligned(int64_t bytes) { return (bytes + 7) / 8 * 8; }
+
+std::string basis_cache_file(std::string const &kind, uint64_t hash) {
+  if (basis_cache_dir.empty()) {
+    return "";
+  }
+  std::stringstream ss;
+  ss << basis_cache_dir << "/" << kind << "_" << std::hex << hash << ".bin";
+  return ss.str();
+}
+
+void write_basis_cache(
+    std::string const &filename, std::vector<int64_t> const &parameters,
+    std::vector<std::pair<void const *, int64_t>> const &arrays) try {
+  int64_t n_parameters = parameters.size();
+  int64_t n_arrays = arrays.size();
+
+  // header: magic, version, n_parameters, n_arrays, parameters,
+  //         (offset, bytes) for every array
+  std::vector<int64_t> header = {(int64_t)basis_cache_magic,
+                                 basis_cache_version, n_parameters, n_arrays};
+  header.insert(header.end(), parameters.begin(), parameters.end());
+  int64_t offset = (header.size() + 2 * n_arrays) * sizeof(int64_t);
+  for (auto [data, bytes] : arrays) {
+    (void)data;
+    header.push_back(offset);
+    header.push_back(bytes);
+    offset += aligned(bytes);
+  }
+
+  // Unique temporary name, such that concurrent writers do not interfere
+  std::stringstream ss;
+  ss << filename << ".tmp." << getpid();
+  std::string tmpname = ss.str();
+  {
+    std::ofstream out(tmpname, std::ios::binary);
+    if (!out) {
+      XDIAG_THROW(std::string("Unable to open basis cache file \"") + tmpname +
+                  "\" for writing");
+    }
+    out.write(reinterpret_cast<char const *>(header.data()),
+              header.size() * sizeof(int64_t));
+    char const zeros[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    for (auto [data, bytes] : arrays) {
+      out.write(reinterpret_cast<char const *>(data), bytes);
+      out.write(zeros, aligned(bytes) - bytes);
+    }
+    if (!out) {
+      std::remove(tmpname.c_str());
+      XDIAG_THROW(std::string("Unable to write basis cache file \"") +
+                  tmpname + "\"");
+    }
+  }
+  if (std::rename(tmpname.c_str(), filename.c_str()) != 0) {
+    std::remove(tmpname.c_str());
+    XDIAG_THROW(std::string("Unable to rename basis cache file to \"") +
+                filename + "\"");
+  }
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+}
+
+BasisCacheFile::BasisCacheFile(std::string const &filename) try {
+  int fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0) {
+    XDIAG_THROW(std::string("Unable to open basis cache file \"") + filename +
+                "\"");
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    close(fd);
+    XDIAG_THROW(std::string("Unable to determine size of basis cache file \"") +
+                filename + "\"");
+  }
+  int64_t size = st.st_size;
+  if (size < 4 * (int64_t)sizeof(int64_t)) {
+    close(fd);
+    XDIAG_THROW(std::string("Invalid basis cache file \"") + filename + "\"");
+  }
+
+  // Shared read-only mapping, the pages are shared with all other processes
+  // mapping the same file
+  void *addr = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (addr == MAP_FAILED) {
+    XDIAG_THROW(std::string("Unable to map basis cache file \"") + filename +
+                "\" into memory");
+  }
+  mapping_ = std::shared_ptr<void const>(
+      addr, [size](void const *ptr) { munmap(const_cast<void *>(ptr), size); });
+
+  int64_t const *header = reinterpret_cast<int64_t const *>(addr);
+  int64_t n_parameters = header[2];
+  int64_t n_arrays = header[3];
+  int64_t header_size = 4 + n_parameters + 2 * n_arrays;
+  if (((uint64_t)header[0] != basis_cache_magic) ||
+      (header[1] != basis_cache_version) || (n_parameters < 0) ||
+      (n_arrays < 0) || (header_size * (int64_t)sizeof(int64_t) > size)) {
+    XDIAG_THROW(std::string("Invalid basis cache file \"") + filename + "\"");
+  }
+  parameters_ = std::vector<int64_t>(header + 4, header + 4 + n_parameters);
+  for (int64_t i = 0; i < n_arrays; ++i) {
+    int64_t offset = header[4 + n_parameters + 2 * i];
+    int64_t bytes = header[4 + n_parameters + 2 * i + 1];
+    if ((offset < 0) || (bytes < 0) || (offset + bytes > size)) {
+      XDIAG_THROW(std::string("Invalid basis cache file \"") + filename +
+                  "\"");
+    }
+    arrays_.push_back({offset, bytes});
+  }
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+}
+
+std::vector<int64_t> const &BasisCacheFile::parameters() const {
+  return parameters_;
+}
+
+int64_t BasisCacheFile::n_arrays() const { return arrays_.size(); }
+
+std::pair<char const *, int64_t>
+BasisCacheFile::array_bytes(int64_t idx) const try {
+  if ((idx < 0) || (idx >= n_arrays())) {
+    XDIAG_THROW("Invalid array index in basis cache file");
+  }
+  auto [offset, bytes] = arrays_[idx];
+  return {reinterpret_cast<char const *>(mapping_.get()) + offset, bytes};
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+}
+
+} // namespace io
+} // namespace xdiag
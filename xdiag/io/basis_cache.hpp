@@ -0,0 +1,60 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <xdiag/common.hpp>
+#include <xdiag/utils/shared_array.hpp>
+
+namespace xdiag {
+
+// Directory in which symmetric bases are stored after they have been
+// computed once. Later jobs with the same block definition map the stored
+// basis into memory instead of recomputing it, and concurrent processes on
+// one node share the mapped pages. An empty directory (default) disables
+// the cache.
+void set_basis_cache_directory(std::string const &directory);
+std::string basis_cache_directory();
+
+namespace io {
+
+// File name in the cache directory for a basis of a given kind and hash of
+// its definition, or an empty string if caching is disabled
+std::string basis_cache_file(std::string const &kind, uint64_t hash);
+
+// Writes a list of integer parameters and arrays to a cache file. The file
+// is written to a temporary name first and then renamed, such that readers
+// never see an incomplete file.
+void write_basis_cache(std::string const &filename,
+                       std::vector<int64_t> const &parameters,
+                       std::vector<std::pair<void const *, int64_t>> const
+                           &arrays); // (data, bytes)
+
+// Cache file mapped read-only into memory
+class BasisCacheFile {
+public:
+  explicit BasisCacheFile(std::string const &filename);
+
+  std::vector<int64_t> const &parameters() const;
+  int64_t n_arrays() const;
+
+  template <typename T> SharedArray<T> array(int64_t idx) const {
+    auto [data, bytes] = array_bytes(idx);
+    return SharedArray<T>(mapping_, reinterpret_cast<T const *>(data),
+                          bytes / (int64_t)sizeof(T));
+  }
+  template <typename T> std::vector<T> vector(int64_t idx) const {
+    auto arr = array<T>(idx);
+    return std::vector<T>(arr.begin(), arr.end());
+  }
+
+private:
+  std::shared_ptr<void const> mapping_;
+  std::vector<int64_t> parameters_;
+  std::vector<std::pair<int64_t, int64_t>> arrays_; // (offset, bytes)
+  std::pair<char const *, int64_t> array_bytes(int64_t idx) const;
+};
+
+} // namespace io
+} // namespace xdiag
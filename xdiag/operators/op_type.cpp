@@ -0,0 +1,35 @@
+#include "op_type.hpp"
+
+#include <unordered_map>
+
+namespace xdiag {
+
+OpType op_type(std::string const &type) {
+  static const std::unordered_map<std::string, OpType> types = {
+      {"HB", OpType::HB},
+      {"TJHB", OpType::TJHB},
+      {"ISING", OpType::ISING},
+      {"TJISING", OpType::TJISING},
+      {"EXCHANGE", OpType::EXCHANGE},
+      {"SZ", OpType::SZ},
+      {"S+", OpType::SPLUS},
+      {"S-", OpType::SMINUS},
+      {"SCALARCHIRALITY", OpType::SCALARCHIRALITY},
+      {"HOP", OpType::HOP},
+      {"HOPUP", OpType::HOPUP},
+      {"HOPDN", OpType::HOPDN},
+      {"NUMBER", OpType::NUMBER},
+      {"NUMBERUP", OpType::NUMBERUP},
+      {"NUMBERDN", OpType::NUMBERDN},
+      {"CDAGUP", OpType::CDAGUP},
+      {"CDAGDN", OpType::CDAGDN},
+      {"CUP", OpType::CUP},
+      {"CDN", OpType::CDN},
+      {"NONBRANCHINGOP", OpType::NONBRANCHINGOP}};
+  auto it = types.find(type);
+  return (it == types.end()) ? OpType::UNKNOWN : it->second;
+}
+
+OpType op_type(Op const &op) { return op_type(op.type()); }
+
+} // namespace xdiag
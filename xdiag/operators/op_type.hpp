@@ -0,0 +1,39 @@
+#pragma once
+
+#include <string>
+
+#include <xdiag/operators/op.hpp>
+
+namespace xdiag {
+
+// Types of Ops known to the apply and matrix kernels. Converting the type
+// string of an Op once lets the kernels be selected by a switch instead of a
+// chain of string comparisons.
+enum class OpType {
+  HB,
+  TJHB,
+  ISING,
+  TJISING,
+  EXCHANGE,
+  SZ,
+  SPLUS,
+  SMINUS,
+  SCALARCHIRALITY,
+  HOP,
+  HOPUP,
+  HOPDN,
+  NUMBER,
+  NUMBERUP,
+  NUMBERDN,
+  CDAGUP,
+  CDAGDN,
+  CUP,
+  CDN,
+  NONBRANCHINGOP,
+  UNKNOWN
+};
+
+OpType op_type(std::string const &type);
+OpType op_type(Op const &op);
+
+} // namespace xdiag
@@ -2,6 +2,7 @@
 
 #ifdef _OPENMP
 
+#include <numeric>
 #include <vector>
 
 #include <omp.h>
@@ -64,6 +65,35 @@ combine_vectors_copy(std::vector<std::vector<T>> const &vec_of_vec) {
   return total_vec;
 }
 
+// Exclusive prefix sum, out[i] = in[0] + ... + in[i-1], where every thread
+// sums a contiguous range. Returns the total sum.
+inline int64_t exclusive_scan(std::vector<int64_t> const &in,
+                              std::vector<int64_t> &out) {
+  int64_t size = in.size();
+  out.resize(size);
+  std::vector<int64_t> sums;
+#pragma omp parallel
+  {
+    int myid = omp_get_thread_num();
+#pragma omp single
+    { sums.resize(omp_get_num_threads(), 0); }
+    auto [start, end] = get_omp_start_end(size);
+    int64_t sum = 0;
+    for (int64_t i = start; i < end; ++i) {
+      out[i] = sum;
+      sum += in[i];
+    }
+    sums[myid] = sum;
+#pragma omp barrier
+    int64_t offset = std::accumulate(sums.begin(), sums.begin() + myid,
+                                     (int64_t)0);
+    for (int64_t i = start; i < end; ++i) {
+      out[i] += offset;
+    }
+  }
+  return std::accumulate(sums.begin(), sums.end(), (int64_t)0);
+}
+
 } // namespace xdiag::omp
 
 #endif // _OPENMP
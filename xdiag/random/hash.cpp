@@ -53,6 +53,9 @@ uint64_t hash(Spinhalf const &block) {
     h = hash_combine(h, hash(block.permutation_group()));
     h = hash_combine(h, hash(block.irrep()));
   }
+  if (block.spinflip() != 0) {
+    h = hash_combine(h, hash_fnv1((uint64_t)block.spinflip()));
+  }
   return h;
 }
 
@@ -17,6 +17,9 @@ public:
   inline PermutationGroup const &permutation_group() const {
     return permutation_group_;
   }
+  inline int64_t inverse(int64_t sym) const {
+    return permutation_group_.inverse(sym);
+  }
 
   template <class bit_t> bit_t apply(int64_t sym, bit_t state) const;
   template <class bit_t> bit_t representative(bit_t state) const;
@@ -8,11 +8,11 @@ namespace xdiag {
 
 template <typename bit_t>
 GroupActionLookup<bit_t>::GroupActionLookup(
-    PermutationGroup const &permutation_group)
+    PermutationGroup const &permutation_group, bool spinflip)
     : n_sites_(permutation_group.n_sites()),
-      n_symmetries_(permutation_group.n_symmetries()),
-      permutation_group_(permutation_group), n_prefix_bits_(n_sites_ / 2),
-      n_postfix_bits_(n_sites_ - n_prefix_bits_),
+      n_symmetries_((spinflip ? 2 : 1) * permutation_group.n_symmetries()),
+      permutation_group_(permutation_group), spinflip_(spinflip),
+      n_prefix_bits_(n_sites_ / 2), n_postfix_bits_(n_sites_ - n_prefix_bits_),
       postfix_mask_(((bit_t)1 << n_postfix_bits_) - 1),
       prefix_size_(pow(2, n_prefix_bits_)),
       postfix_size_(pow(2, n_postfix_bits_)),
@@ -20,22 +20,29 @@ GroupActionLookup<bit_t>::GroupActionLookup(
       table_postfix_(n_symmetries_ * postfix_size_, 0) {
 
   auto action = GroupAction(permutation_group);
+  int64_t n_perms = permutation_group.n_symmetries();
+  bit_t sitesmask = (n_sites_ == (int64_t)(8 * sizeof(bit_t)))
+                        ? ~(bit_t)0
+                        : (((bit_t)1 << n_sites_) - 1);
 
   int64_t idx = 0;
-  // Fill prefix table with translated prefix states
-  for (int sym = 0; sym < n_symmetries_; ++sym) {
+  // Fill prefix table with translated prefix states (and the spin flip)
+  for (int64_t sym = 0; sym < n_symmetries_; ++sym) {
+    int64_t perm = sym % n_perms;
+    bit_t flip = (sym < n_perms) ? 0 : sitesmask;
     for (bit_t state = 0; state < (bit_t)prefix_size_; ++state) {
       table_prefix_[idx++] =
-          action.apply(sym, (bit_t)(state << n_postfix_bits_));
+          action.apply(perm, (bit_t)(state << n_postfix_bits_)) ^ flip;
     }
   }
   assert(idx == (int64_t)table_prefix_.size());
 
   // Fill postfix table
   idx = 0;
-  for (int sym = 0; sym < n_symmetries_; ++sym) {
+  for (int64_t sym = 0; sym < n_symmetries_; ++sym) {
+    int64_t perm = sym % n_perms;
     for (bit_t state = 0; state < (bit_t)postfix_size_; ++state) {
-      table_postfix_[idx++] = action.apply(sym, state);
+      table_postfix_[idx++] = action.apply(perm, state);
     }
   }
 
@@ -45,7 +52,8 @@ GroupActionLookup<bit_t>::GroupActionLookup(
 template <typename bit_t>
 bool GroupActionLookup<bit_t>::operator==(GroupActionLookup const &rhs) const {
   return (n_sites_ == rhs.n_sites_) && (n_symmetries_ == rhs.n_symmetries_) &&
-         (permutation_group_ == rhs.permutation_group_);
+         (permutation_group_ == rhs.permutation_group_) &&
+         (spinflip_ == rhs.spinflip_);
 }
 template <typename bit_t>
 bool GroupActionLookup<bit_t>::operator!=(GroupActionLookup const &rhs) const {
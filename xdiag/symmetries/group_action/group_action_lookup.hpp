@@ -6,24 +6,43 @@
 
 namespace xdiag {
 
+// Lookup tables for the action of a permutation group on bit states. If
+// spinflip is set, the group is extended by a global spin flip: symmetries
+// n_perms <= sym < 2 * n_perms act as the permutation sym - n_perms followed
+// by inverting all bits. The flip is stored in the prefix table, such that
+// the two table entries are combined by XOR instead of OR.
 template <class bit_t> class GroupActionLookup {
 public:
   GroupActionLookup() = default;
-  explicit GroupActionLookup(PermutationGroup const &permutation_group);
+  explicit GroupActionLookup(PermutationGroup const &permutation_group,
+                             bool spinflip = false);
 
   inline int64_t n_sites() const { return n_sites_; }
   inline int64_t n_symmetries() const { return n_symmetries_; }
   inline PermutationGroup const &permutation_group() const {
     return permutation_group_;
   }
+  inline bool spinflip() const { return spinflip_; }
 
   inline bit_t apply(int64_t sym, bit_t state) const {
-    // return table_prefix_[sym * prefix_size_ + (state >> n_postfix_bits_)] |
+    // return table_prefix_[sym * prefix_size_ + (state >> n_postfix_bits_)] ^
     //        table_postfix_[sym * postfix_size_ + (state & postfix_mask_)];
-    return table_prefix_[(sym << n_prefix_bits_) | (state >> n_postfix_bits_)] |
+    return table_prefix_[(sym << n_prefix_bits_) | (state >> n_postfix_bits_)] ^
            table_postfix_[(sym << n_postfix_bits_) | (state & postfix_mask_)];
   }
 
+  // the spin flip commutes with all permutations
+  inline int64_t inverse(int64_t sym) const {
+    int64_t n_perms = permutation_group_.size();
+    return (sym < n_perms) ? permutation_group_.inverse(sym)
+                           : n_perms + permutation_group_.inverse(sym - n_perms);
+  }
+
+  inline int64_t memory() const { // in bytes
+    return (int64_t)((table_prefix_.size() + table_postfix_.size()) *
+                     sizeof(bit_t));
+  }
+
   bool operator==(GroupActionLookup const &rhs) const;
   bool operator!=(GroupActionLookup const &rhs) const;
 
@@ -31,6 +50,7 @@ private:
   int64_t n_sites_;
   int64_t n_symmetries_;
   PermutationGroup permutation_group_;
+  bool spinflip_ = false;
 
   int64_t n_prefix_bits_;
   int64_t n_postfix_bits_;
@@ -10,10 +10,14 @@ namespace xdiag {
 
 template <typename bit_t, int n_sublat>
 GroupActionSublattice<bit_t, n_sublat>::GroupActionSublattice(
-    PermutationGroup const &permutation_group)
+    PermutationGroup const &permutation_group, bool spinflip)
     : n_sites_(permutation_group.n_sites()),
-      n_symmetries_(permutation_group.n_symmetries()),
-      permutation_group_(permutation_group),
+      n_symmetries_((spinflip ? 2 : 1) * permutation_group.n_symmetries()),
+      permutation_group_(permutation_group), spinflip_(spinflip),
+      n_perms_(permutation_group.n_symmetries()),
+      sitesmask_((n_sites_ == (int64_t)(8 * sizeof(bit_t)))
+                     ? ~(bit_t)0
+                     : (((bit_t)1 << n_sites_) - 1)),
       n_sites_sublat_(n_sites_ / n_sublat),
       size_tables_(pow(2, n_sites_sublat_)),
       sublat_mask_(((half_bit_t)1 << n_sites_sublat_) - 1),
@@ -39,7 +43,7 @@ GroupActionSublattice<bit_t, n_sublat>::GroupActionSublattice(
     auto &rep_syms_array = rep_syms_array_[sublat];
     reps.resize(size_tables_);
     rep_syms.resize(size_tables_);
-    sym_action_[sublat].resize(size_tables_ * n_symmetries_);
+    sym_action_[sublat].resize(size_tables_ * n_perms_);
 
     // Compute all representative and representative symmetries
     std::vector<int64_t> rep_syms_begin(size_tables_);
@@ -102,9 +106,13 @@ template <typename bit_t, int n_sublat>
 bit_t GroupActionSublattice<bit_t, n_sublat>::apply(int64_t sym,
                                                     bit_t state) const {
   bit_t translated = 0;
+  if (sym >= n_perms_) {
+    sym -= n_perms_;
+    translated = sitesmask_;
+  }
   for (int sublat = 0; sublat < n_sublat; ++sublat) {
     half_bit_t substate = (state >> sublat_shift_[sublat]) & sublat_mask_;
-    translated |= sym_action(sublat, sym, substate);
+    translated ^= sym_action(sublat, sym, substate);
   }
   return translated;
 }
@@ -112,6 +120,55 @@ bit_t GroupActionSublattice<bit_t, n_sublat>::apply(int64_t sym,
 template <typename bit_t, int n_sublat>
 bit_t GroupActionSublattice<bit_t, n_sublat>::representative(
     bit_t state) const {
+  bit_t rep = representative_perm(state);
+  if (spinflip_) {
+    rep = std::min(rep, representative_perm((~state) & sitesmask_));
+  }
+  return rep;
+}
+
+template <typename bit_t, int n_sublat>
+std::pair<bit_t, int64_t>
+GroupActionSublattice<bit_t, n_sublat>::representative_sym(bit_t state) const {
+  auto [rep, sym] = representative_sym_perm(state);
+  if (spinflip_) {
+    auto [rep_flip, sym_flip] = representative_sym_perm((~state) & sitesmask_);
+    if (rep_flip < rep) {
+      return {rep_flip, n_perms_ + sym_flip};
+    }
+  }
+  return {rep, sym};
+}
+
+template <typename bit_t, int n_sublat>
+std::pair<bit_t, gsl::span<int64_t const>>
+GroupActionSublattice<bit_t, n_sublat>::representative_syms(bit_t state) const {
+  auto [rep, syms] = representative_syms_perm(state, 0);
+  if (!spinflip_) {
+    return {rep, syms};
+  }
+
+  // symmetries of the flipped state are stored after the ones of the state if
+  // both yield the same representative, and replace them if smaller
+  bit_t flipped = (~state) & sitesmask_;
+  bit_t rep_flip = representative_perm(flipped);
+  if (rep_flip > rep) {
+    return {rep, syms};
+  }
+  int64_t offset = (rep_flip == rep) ? syms.size() : 0;
+  auto [rep_flip2, syms_flip] = representative_syms_perm(flipped, offset);
+  (void)rep_flip2;
+  for (int64_t i = offset; i < offset + (int64_t)syms_flip.size(); ++i) {
+    representative_syms_[i] += n_perms_;
+  }
+  return {rep_flip,
+          {representative_syms_.data(),
+           (gsl::span<int64_t const>::size_type)(offset + syms_flip.size())}};
+}
+
+template <typename bit_t, int n_sublat>
+bit_t GroupActionSublattice<bit_t, n_sublat>::representative_perm(
+    bit_t state) const {
 
   // Determine sublattice states representatives
   std::array<half_bit_t, n_sublat> sublat_state;
@@ -154,7 +211,8 @@ bit_t GroupActionSublattice<bit_t, n_sublat>::representative(
 
 template <typename bit_t, int n_sublat>
 std::pair<bit_t, int64_t>
-GroupActionSublattice<bit_t, n_sublat>::representative_sym(bit_t state) const {
+GroupActionSublattice<bit_t, n_sublat>::representative_sym_perm(
+    bit_t state) const {
 
   // Determine sublattice states representatives
   std::array<half_bit_t, n_sublat> sublat_state;
@@ -199,7 +257,8 @@ GroupActionSublattice<bit_t, n_sublat>::representative_sym(bit_t state) const {
 
 template <typename bit_t, int n_sublat>
 std::pair<bit_t, gsl::span<int64_t const>>
-GroupActionSublattice<bit_t, n_sublat>::representative_syms(bit_t state) const {
+GroupActionSublattice<bit_t, n_sublat>::representative_syms_perm(
+    bit_t state, int64_t offset) const {
 
   // Determine sublattice states representatives
   std::array<half_bit_t, n_sublat> sublat_state;
@@ -235,21 +294,34 @@ GroupActionSublattice<bit_t, n_sublat>::representative_syms(bit_t state) const {
         if (candidate < representative) {
           representative = candidate;
           n_syms = 1;
-          representative_syms_[0] = sym;
+          representative_syms_[offset] = sym;
         } else if (candidate == representative) {
-          representative_syms_[n_syms++] = sym;
+          representative_syms_[offset + n_syms++] = sym;
         }
       }
     }
   }
-  return {representative, {representative_syms_.data(), n_syms}};
+  return {representative, {representative_syms_.data() + offset, n_syms}};
+}
+
+template <typename bit_t, int n_sublat>
+int64_t GroupActionSublattice<bit_t, n_sublat>::memory() const {
+  int64_t memory = representative_syms_.size() * sizeof(int64_t);
+  for (int sublat = 0; sublat < n_sublat; ++sublat) {
+    memory += reps_[sublat].size() * sizeof(half_bit_t);
+    memory += rep_syms_[sublat].size() * sizeof(gsl::span<int64_t const>);
+    memory += rep_syms_array_[sublat].size() * sizeof(int64_t);
+    memory += sym_action_[sublat].size() * sizeof(bit_t);
+  }
+  return memory;
 }
 
 template <typename bit_t, int n_sublat>
 bool GroupActionSublattice<bit_t, n_sublat>::operator==(
     GroupActionSublattice const &rhs) const {
   return (n_sites_ == rhs.n_sites_) && (n_symmetries_ == rhs.n_symmetries_) &&
-         (permutation_group_ == rhs.permutation_group_);
+         (permutation_group_ == rhs.permutation_group_) &&
+         (spinflip_ == rhs.spinflip_);
 }
 template <typename bit_t, int n_sublat>
 bool GroupActionSublattice<bit_t, n_sublat>::operator!=(
@@ -14,18 +14,28 @@ namespace basis::spinhalf {
 template <typename bit_t, int n_sublat> class BasisSublattice;
 }
 
+// Sublattice coded group action. If spinflip is set, the group is extended
+// by a global spin flip as in GroupActionLookup. Since the spin flip commutes
+// with all permutations, the representative of a state is the smaller one of
+// the representatives of the state and of its flipped state.
 template <typename bit_t, int n_sublat> class GroupActionSublattice {
 public:
   using half_bit_t = bits::half_bit_t<bit_t>;
 
   GroupActionSublattice() = default;
-  GroupActionSublattice(PermutationGroup const &permutation_group);
+  GroupActionSublattice(PermutationGroup const &permutation_group,
+                        bool spinflip = false);
 
   inline int64_t n_sites() const { return n_sites_; }
   inline int64_t n_symmetries() const { return n_symmetries_; }
   inline PermutationGroup const &permutation_group() const {
     return permutation_group_;
   }
+  inline bool spinflip() const { return spinflip_; }
+  inline int64_t inverse(int64_t sym) const {
+    return (sym < n_perms_) ? permutation_group_.inverse(sym)
+                            : n_perms_ + permutation_group_.inverse(sym - n_perms_);
+  }
 
   bit_t apply(int64_t sym, bit_t state) const;
   bit_t representative(bit_t state) const;
@@ -33,6 +43,8 @@ public:
   std::pair<bit_t, gsl::span<int64_t const>>
   representative_syms(bit_t state) const;
 
+  int64_t memory() const; // in bytes
+
   bool operator==(GroupActionSublattice const &rhs) const;
   bool operator!=(GroupActionSublattice const &rhs) const;
 
@@ -40,6 +52,9 @@ private:
   int64_t n_sites_;
   int64_t n_symmetries_;
   PermutationGroup permutation_group_;
+  bool spinflip_ = false;
+  int64_t n_perms_;
+  bit_t sitesmask_;
 
   int64_t n_sites_sublat_;
   int64_t size_tables_;
@@ -48,11 +63,11 @@ private:
   std::array<int, n_sublat> sublat_shift_;
 
   inline bit_t &sym_action(int sublat, int sym, half_bit_t bits) {
-    return sym_action_[sublat][(int64_t)bits * n_symmetries_ + sym];
+    return sym_action_[sublat][(int64_t)bits * n_perms_ + sym];
   }
 
   inline bit_t const &sym_action(int sublat, int sym, half_bit_t bits) const {
-    return sym_action_[sublat][(int64_t)bits * n_symmetries_ + sym];
+    return sym_action_[sublat][(int64_t)bits * n_perms_ + sym];
   }
 
   std::array<std::vector<half_bit_t>, n_sublat> reps_;
@@ -60,6 +75,12 @@ private:
   std::array<std::vector<int64_t>, n_sublat> rep_syms_array_;
   std::array<std::vector<bit_t>, n_sublat> sym_action_;
 
+  // representative search among the permutations only
+  bit_t representative_perm(bit_t state) const;
+  std::pair<bit_t, int64_t> representative_sym_perm(bit_t state) const;
+  std::pair<bit_t, gsl::span<int64_t const>>
+  representative_syms_perm(bit_t state, int64_t offset) const;
+
   friend class basis::spinhalf::BasisSublattice<bit_t, n_sublat>;
 };
 
@@ -0,0 +1,136 @@
+#include "representative_sublattice.hpp"
+
+#include <numeric>
+
+#include <xdiag/symmetries/group_action/sublattice_stability.hpp>
+
+namespace xdiag {
+
+template <typename bit_t>
+RepresentativeSublattice<bit_t>::RepresentativeSublattice(
+    int64_t n_sublat, PermutationGroup const &group,
+    std::vector<bit_t> const &reps) try
+    : n_sublat_(n_sublat), n_symmetries_(group.n_symmetries()),
+      identity_syms_(n_symmetries_) {
+  int64_t n_sites = group.n_sites();
+  if ((n_sublat < 1) || (n_sublat > 5)) {
+    XDIAG_THROW("Invalid n_sublat specified. Must be between 1 and 5.");
+  } else if (n_sites % n_sublat != 0) {
+    XDIAG_THROW("Number of sites is not divisible by n_sublat");
+  } else if (n_sites / n_sublat > 4 * (int64_t)sizeof(bit_t)) {
+    XDIAG_THROW("Too many sites per sublattice for the given bit type");
+  } else if (!symmetries::is_sublattice_stable(n_sublat, group)) {
+    XDIAG_THROW("PermutationGroup is not sublattice stable");
+  }
+
+  if (n_sublat == 1) {
+    group_action_ = GroupActionSublattice<bit_t, 1>(group);
+  } else if (n_sublat == 2) {
+    group_action_ = GroupActionSublattice<bit_t, 2>(group);
+  } else if (n_sublat == 3) {
+    group_action_ = GroupActionSublattice<bit_t, 3>(group);
+  } else if (n_sublat == 4) {
+    group_action_ = GroupActionSublattice<bit_t, 4>(group);
+  } else {
+    group_action_ = GroupActionSublattice<bit_t, 5>(group);
+  }
+  std::iota(identity_syms_.begin(), identity_syms_.end(), 0);
+
+  // Determine the representatives with non-trivial stabilizer
+  int64_t n_reps = reps.size();
+  std::vector<int64_t> stabilizer_size(n_reps, 0);
+  std::visit(
+      [&](auto const &group_action) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(guided)
+#endif
+        for (int64_t rep_idx = 0; rep_idx < n_reps; ++rep_idx) {
+          bit_t rep = reps[rep_idx];
+          int64_t size = 0;
+          for (int64_t sym = 0; sym < n_symmetries_; ++sym) {
+            if (group_action.apply(sym, rep) == rep) {
+              ++size;
+            }
+          }
+          stabilizer_size[rep_idx] = size;
+        }
+      },
+      group_action_);
+
+  nontrivial_.resize(n_reps, false);
+  for (int64_t rep_idx = 0; rep_idx < n_reps; ++rep_idx) {
+    if (stabilizer_size[rep_idx] > 1) {
+      nontrivial_[rep_idx] = true;
+      nontrivial_reps_.push_back(rep_idx);
+      stabilizer_size_.push_back(stabilizer_size[rep_idx]);
+    }
+  }
+
+  // For every representative with non-trivial stabilizer, the symmetries
+  // are grouped by the state they map to the representative. coset_start_
+  // points to the group of every symmetry.
+  int64_t n_nontrivial = nontrivial_reps_.size();
+  coset_syms_.resize(n_nontrivial * n_symmetries_);
+  coset_start_.resize(n_nontrivial * n_symmetries_);
+  std::visit(
+      [&](auto const &group_action) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(guided)
+#endif
+        for (int64_t k = 0; k < n_nontrivial; ++k) {
+          bit_t rep = reps[nontrivial_reps_[k]];
+          int64_t offset = k * n_symmetries_;
+          std::vector<std::pair<bit_t, int64_t>> states_syms(n_symmetries_);
+          for (int64_t sym = 0; sym < n_symmetries_; ++sym) {
+            bit_t state = group_action.apply(group.inverse(sym), rep);
+            states_syms[sym] = {state, sym};
+          }
+          std::sort(states_syms.begin(), states_syms.end());
+          int64_t start = 0;
+          for (int64_t i = 0; i < n_symmetries_; ++i) {
+            if (states_syms[i].first != states_syms[start].first) {
+              start = i;
+            }
+            auto [state, sym] = states_syms[i];
+            coset_syms_[offset + i] = sym;
+            coset_start_[offset + sym] = offset + start;
+          }
+        }
+      },
+      group_action_);
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+}
+
+template <typename bit_t>
+int64_t RepresentativeSublattice<bit_t>::n_sublat() const {
+  return n_sublat_;
+}
+
+template <typename bit_t>
+std::pair<bit_t, int64_t>
+RepresentativeSublattice<bit_t>::representative_sym(bit_t state) const {
+  return std::visit(
+      [&](auto const &group_action) {
+        return group_action.representative_sym(state);
+      },
+      group_action_);
+}
+
+template <typename bit_t>
+int64_t RepresentativeSublattice<bit_t>::memory() const {
+  int64_t memory = std::visit(
+      [](auto const &group_action) { return group_action.memory(); },
+      group_action_);
+  memory += (identity_syms_.size() + nontrivial_reps_.size() +
+             stabilizer_size_.size() + coset_syms_.size() +
+             coset_start_.size()) *
+            sizeof(int64_t);
+  memory += nontrivial_.size() / 8;
+  return memory;
+}
+
+template class RepresentativeSublattice<uint32_t>;
+template class RepresentativeSublattice<uint64_t>;
+
+} // namespace xdiag
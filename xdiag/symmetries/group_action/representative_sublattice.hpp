@@ -0,0 +1,62 @@
+#pragma once
+
+#include <algorithm>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <xdiag/common.hpp>
+#include <xdiag/extern/gsl/span>
+#include <xdiag/symmetries/group_action/group_action_sublattice.hpp>
+#include <xdiag/symmetries/permutation_group.hpp>
+
+namespace xdiag {
+
+// Sublattice coded representative search for a sorted list of
+// representatives. Instead of storing the index and symmetries for every
+// state, the representative is computed on the fly and the symmetries
+// mapping a state to its representative are retrieved from small tables,
+// which are only stored for representatives with a non-trivial stabilizer.
+template <typename bit_t> class RepresentativeSublattice {
+public:
+  RepresentativeSublattice() = default;
+  RepresentativeSublattice(int64_t n_sublat,
+                           PermutationGroup const &permutation_group,
+                           std::vector<bit_t> const &reps);
+
+  int64_t n_sublat() const;
+  std::pair<bit_t, int64_t> representative_sym(bit_t state) const;
+  int64_t memory() const; // in bytes
+
+  // symmetries mapping a state to the representative with index rep_idx,
+  // where sym is any of these symmetries
+  inline gsl::span<int64_t const> syms(int64_t rep_idx, int64_t sym) const {
+    if (!nontrivial_[rep_idx]) {
+      return {identity_syms_.data() + sym, 1};
+    } else {
+      auto it = std::lower_bound(nontrivial_reps_.begin(),
+                                 nontrivial_reps_.end(), rep_idx);
+      int64_t k = it - nontrivial_reps_.begin();
+      int64_t start = coset_start_[k * n_symmetries_ + sym];
+      return {coset_syms_.data() + start,
+              (gsl::span<int64_t const>::size_type)stabilizer_size_[k]};
+    }
+  }
+
+private:
+  int64_t n_sublat_;
+  int64_t n_symmetries_;
+  std::variant<GroupActionSublattice<bit_t, 1>, GroupActionSublattice<bit_t, 2>,
+               GroupActionSublattice<bit_t, 3>, GroupActionSublattice<bit_t, 4>,
+               GroupActionSublattice<bit_t, 5>>
+      group_action_;
+
+  std::vector<int64_t> identity_syms_;
+  std::vector<bool> nontrivial_;
+  std::vector<int64_t> nontrivial_reps_;
+  std::vector<int64_t> stabilizer_size_;
+  std::vector<int64_t> coset_syms_;
+  std::vector<int64_t> coset_start_;
+};
+
+} // namespace xdiag
@@ -16,7 +16,7 @@ bool fermi_bool_of_permutation(bit_t state, Permutation const &permutation,
   int64_t n_fermion = 0;
   int64_t site = 0;
   while (state) {
-    int64_t trailing_zeros = __builtin_ctz(state);
+    int64_t trailing_zeros = __builtin_ctzll((uint64_t)state);
     site += trailing_zeros;
     work[n_fermion++] = permutation[site++];
     state >>= trailing_zeros + 1;
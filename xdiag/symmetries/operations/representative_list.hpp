@@ -1,11 +1,15 @@
 #pragma once
 
 #include <numeric>
+#include <tuple>
 #include <utility>
 #include <vector>
 
+#include <xdiag/combinatorics/combinations_index.hpp>
+#include <xdiag/combinatorics/subsets_index.hpp>
 #include <xdiag/common.hpp>
 #include <xdiag/extern/gsl/span>
+#include <xdiag/parallel/omp/omp_utils.hpp>
 #include <xdiag/symmetries/operations/group_action_operations.hpp>
 #include <xdiag/symmetries/operations/symmetry_operations.hpp>
 #include <xdiag/utils/logger.hpp>
@@ -14,6 +18,77 @@ namespace xdiag::symmetries {
 
 using span_size_t = gsl::span<int64_t const>::size_type;
 
+// Computes the representatives and their norms. With OpenMP every thread
+// enumerates a contiguous range of states and the representatives are merged
+// in order, so the result does not depend on the number of threads.
+template <typename bit_t, class StatesIndexing, class GroupAction>
+inline std::pair<std::vector<bit_t>, std::vector<double>>
+representatives_norms(StatesIndexing &&states_indexing,
+                      GroupAction &&group_action,
+                      Representation const &irrep) try {
+  std::vector<bit_t> reps;
+  std::vector<double> norms;
+
+  try {
+#ifdef _OPENMP
+    std::vector<std::vector<bit_t>> reps_thread;
+    std::vector<std::vector<double>> norms_thread;
+    bool failed = false;
+#pragma omp parallel
+    {
+      int myid = omp_get_thread_num();
+#pragma omp single
+      {
+        reps_thread.resize(omp_get_num_threads());
+        norms_thread.resize(omp_get_num_threads());
+      }
+      try {
+        auto states_indices = states_indexing.states_indices();
+        for (auto [state, idx] :
+             combinatorics::ThreadStatesIndex(states_indices)) {
+          if (is_representative(state, group_action)) {
+            double nrm = symmetries::norm(state, group_action, irrep);
+            if (std::abs(nrm) > 1e-6) {
+              reps_thread[myid].push_back(state);
+              norms_thread[myid].push_back(nrm);
+            }
+          }
+        }
+      } catch (...) {
+#pragma omp atomic write
+        failed = true;
+      }
+    }
+    if (failed) {
+      throw std::bad_alloc();
+    }
+    reps = omp::combine_vectors(reps_thread);
+    norms = omp::combine_vectors(norms_thread);
+#else
+    for (auto [state, idx] : states_indexing.states_indices()) {
+      if (is_representative(state, group_action)) {
+        double nrm = symmetries::norm(state, group_action, irrep);
+        if (std::abs(nrm) > 1e-6) {
+          reps.push_back(state);
+          norms.push_back(nrm);
+        }
+      }
+    }
+    reps.shrink_to_fit();
+    norms.shrink_to_fit();
+#endif
+  } catch (...) {
+    XDIAG_THROW("Unable to compute representatives or norms, likely out-of-memory");
+  }
+
+  return {reps, norms};
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+  return std::pair<std::vector<bit_t>, std::vector<double>>();
+}
+
+// Computes the representatives, their norms, the index of the representative
+// for every state and the symmetries mapping a state to its representative.
 template <typename bit_t, class StatesIndexing, class GroupAction>
 inline std::tuple<
     std::vector<bit_t>, std::vector<int64_t>, std::vector<int64_t>,
@@ -33,27 +108,15 @@ representatives_indices_symmetries_limits_norms(
   // Compute all representatives
   std::vector<bit_t> reps;
   std::vector<double> norms;
-
-  try {
-    for (auto [state, idx] : states_indexing.states_indices()) {
-      if (is_representative(state, group_action)) {
-        double nrm = symmetries::norm(state, group_action, irrep);
-        if (std::abs(nrm) > 1e-6) {
-          idces[idx] = reps.size();
-          reps.push_back(state);
-          norms.push_back(nrm);
-        }
-      }
-    }
-    reps.shrink_to_fit();
-    norms.shrink_to_fit();
-  } catch (...) {
-    XDIAG_THROW("Unable to compute idces or norms, likely out-of-memory");
-  }
+  std::tie(reps, norms) =
+      representatives_norms<bit_t>(states_indexing, group_action, irrep);
 
   int64_t n_reps = reps.size();
+  int64_t n_symmetries = group_action.n_symmetries();
 
-  // Determine the number of syms yielding the representative for each state
+  // Determine the number of syms yielding the representative for each state.
+  // Orbits of different representatives are disjoint, hence every state is
+  // only written by the thread treating its representative.
   std::vector<int64_t> n_syms_for_state;
   try {
     n_syms_for_state.resize(size, 0);
@@ -61,10 +124,13 @@ representatives_indices_symmetries_limits_norms(
     XDIAG_THROW("Cannot allocate memory for n_syms_for_state array");
   }
 
+#ifdef _OPENMP
+#pragma omp parallel for schedule(guided)
+#endif
   for (int64_t rep_idx = 0; rep_idx < n_reps; ++rep_idx) {
     bit_t rep = reps[rep_idx];
 
-    for (int64_t sym = 0; sym < group_action.n_symmetries(); ++sym) {
+    for (int64_t sym = 0; sym < n_symmetries; ++sym) {
       bit_t state = group_action.apply(sym, rep);
       int64_t idx = states_indexing.index(state);
       idces[idx] = rep_idx;
@@ -72,17 +138,6 @@ representatives_indices_symmetries_limits_norms(
     }
   }
 
-  // compute size and allocate syms array
-  int64_t n_syms = std::accumulate(n_syms_for_state.begin(),
-                                   n_syms_for_state.end(), (int64_t)0);
-
-  std::vector<int64_t> syms;
-  try {
-    syms.resize(n_syms, 0);
-  } catch (...) {
-    XDIAG_THROW("Cannot allocate memory for symmetry array");
-  }
-
   // compute the sym offsets
   std::vector<int64_t> n_syms_for_state_offset;
   try {
@@ -90,11 +145,24 @@ representatives_indices_symmetries_limits_norms(
   } catch (...) {
     XDIAG_THROW("Cannot allocate memory for n_syms_for_state_offset array");
   }
-  // std::exclusive_scan(n_syms_for_state.begin(), n_syms_for_state.end(),
-  //                     n_syms_for_state_offset.begin(), 0);
+#ifdef _OPENMP
+  int64_t n_syms =
+      omp::exclusive_scan(n_syms_for_state, n_syms_for_state_offset);
+#else
+  int64_t n_syms = 0;
+  for (int64_t idx = 0; idx < size; ++idx) {
+    n_syms_for_state_offset[idx] = n_syms;
+    n_syms += n_syms_for_state[idx];
+  }
+#endif
 
-  std::partial_sum(n_syms_for_state.begin(), n_syms_for_state.end() - 1,
-                   n_syms_for_state_offset.begin() + 1);
+  // allocate syms array
+  std::vector<int64_t> syms;
+  try {
+    syms.resize(n_syms, 0);
+  } catch (...) {
+    XDIAG_THROW("Cannot allocate memory for symmetry array");
+  }
 
   // set the sym_limits
   std::vector<std::pair<span_size_t, span_size_t>> sym_limits;
@@ -104,23 +172,26 @@ representatives_indices_symmetries_limits_norms(
     XDIAG_THROW("Cannot allocate memory for symmetry limits array");
   }
 
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
   for (int64_t idx = 0; idx < size; ++idx) {
     sym_limits[idx] = {n_syms_for_state_offset[idx], n_syms_for_state[idx]};
+    n_syms_for_state[idx] = 0; // used as a counter below
   }
 
-  // empty n_syms_for_state again, now used as a counter
-  std::fill(n_syms_for_state.begin(), n_syms_for_state.end(), 0);
-
   // calculate the symmetries yielding the representative
-  auto const &group = group_action.permutation_group();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(guided)
+#endif
   for (int64_t rep_idx = 0; rep_idx < n_reps; ++rep_idx) {
     bit_t rep = reps[rep_idx];
 
-    for (int64_t sym = 0; sym < group_action.n_symmetries(); ++sym) {
+    for (int64_t sym = 0; sym < n_symmetries; ++sym) {
       bit_t state = group_action.apply(sym, rep);
       int64_t idx = states_indexing.index(state);
 
-      int64_t sym_inv = group.inverse(sym);
+      int64_t sym_inv = group_action.inverse(sym);
       int64_t idx_sym = n_syms_for_state_offset[idx] + n_syms_for_state[idx]++;
       syms[idx_sym] = sym_inv;
     }
@@ -162,49 +233,95 @@ electron_dns_norms_limits_offset_size(std::vector<bit_t> const &reps_up,
                                       GroupAction &&group_action,
                                       Representation const &irrep) try {
 
+  int64_t n_reps_up = reps_up.size();
   std::vector<bit_t> dns_storage;
   std::vector<double> norms_storage;
-  std::vector<std::pair<span_size_t, span_size_t>> dns_limits(reps_up.size());
-  std::vector<int64_t> ups_offset((reps_up.size()));
+  std::vector<std::pair<span_size_t, span_size_t>> dns_limits(n_reps_up);
+  std::vector<int64_t> ups_offset(n_reps_up);
 
   // if ups have trivial stabilizer, dns  are stored in front
   for (bit_t dns : states_dns) {
     dns_storage.push_back(dns);
     norms_storage.push_back(1.0);
   }
+  span_size_t n_dns = dns_storage.size();
 
-  int64_t size = 0;
-  int64_t idx_up = 0;
-  for (bit_t ups : reps_up) {
-    ups_offset[idx_up] = size;
+  // Sets the dns limits of one up representative. If the ups have a
+  // non-trivial stabilizer, its dns configurations are appended to the given
+  // storage and the start is relative to the beginning of this storage.
+  auto set_dns_limits = [&](int64_t idx_up, std::vector<bit_t> &dns_out,
+                            std::vector<double> &norms_out) -> bool {
+    bit_t ups = reps_up[idx_up];
     auto syms = mapping_syms(ups, ups, group_action);
 
     // ups have trivial stabilizer -> dns stored in beginning
     if (syms.size() == 1) {
-      span_size_t start = 0;
-      span_size_t length = states_dns.size();
-      dns_limits[idx_up] = {start, length};
-      size += length;
+      dns_limits[idx_up] = {0, n_dns};
+      return false;
     } // ups have non-trivial stabilizer, we store the dns configurations
     else {
-      span_size_t start = dns_storage.size();
+      span_size_t start = dns_out.size();
       for (bit_t dns : states_dns) {
         bit_t dns_rep = representative_subset(dns, group_action, syms);
         if (dns == dns_rep) {
           double norm =
               norm_electron_subset(ups, dns, group_action, irrep, syms);
           if (norm > 1e-6) {
-            dns_storage.push_back(dns_rep);
-            norms_storage.push_back(norm);
+            dns_out.push_back(dns_rep);
+            norms_out.push_back(norm);
           }
         }
       }
-      span_size_t end = dns_storage.size();
-      span_size_t length = end - start;
+      span_size_t length = dns_out.size() - start;
       dns_limits[idx_up] = {start, length};
-      size += length;
+      return true;
+    }
+  };
+
+#ifdef _OPENMP
+  // Every thread treats a contiguous range of ups, the stored dns are merged
+  // in order such that the result does not depend on the number of threads
+  std::vector<std::vector<bit_t>> dns_thread;
+  std::vector<std::vector<double>> norms_thread;
+#pragma omp parallel
+  {
+    int myid = omp_get_thread_num();
+#pragma omp single
+    {
+      dns_thread.resize(omp_get_num_threads() + 1);
+      norms_thread.resize(omp_get_num_threads() + 1);
     }
-    ++idx_up;
+    auto [start, end] = omp::get_omp_start_end(n_reps_up);
+    std::vector<int64_t> stored;
+    for (int64_t idx_up = start; idx_up < end; ++idx_up) {
+      if (set_dns_limits(idx_up, dns_thread[myid + 1],
+                         norms_thread[myid + 1])) {
+        stored.push_back(idx_up);
+      }
+    }
+#pragma omp barrier
+    span_size_t offset = n_dns;
+    for (int id = 0; id < myid; ++id) {
+      offset += dns_thread[id + 1].size();
+    }
+    for (int64_t idx_up : stored) {
+      dns_limits[idx_up].first += offset;
+    }
+  }
+  dns_thread[0] = std::move(dns_storage);
+  norms_thread[0] = std::move(norms_storage);
+  dns_storage = omp::combine_vectors(dns_thread);
+  norms_storage = omp::combine_vectors(norms_thread);
+#else
+  for (int64_t idx_up = 0; idx_up < n_reps_up; ++idx_up) {
+    set_dns_limits(idx_up, dns_storage, norms_storage);
+  }
+#endif
+
+  int64_t size = 0;
+  for (int64_t idx_up = 0; idx_up < n_reps_up; ++idx_up) {
+    ups_offset[idx_up] = size;
+    size += dns_limits[idx_up].second;
   }
 
   return {dns_storage, norms_storage, dns_limits, ups_offset, size};
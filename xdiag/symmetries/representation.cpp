@@ -223,6 +223,22 @@ PermutationGroup allowed_subgroup(PermutationGroup const &group,
   }
 }
 
+Representation spinflip_representation(Representation const &irrep,
+                                       int64_t parity) try {
+  if ((parity != 1) && (parity != -1)) {
+    XDIAG_THROW("Spin flip parity must be either +1 or -1");
+  }
+  auto const &characters = irrep.characters();
+  std::vector<complex> characters_flip(characters);
+  for (auto c : characters) {
+    characters_flip.push_back((double)parity * c);
+  }
+  return Representation(characters_flip);
+} catch (Error const &e) {
+  XDIAG_RETHROW(e);
+  return Representation();
+}
+
 std::ostream &operator<<(std::ostream &out, Representation const &irrep) {
   out << "size      : " << irrep.size() << "\n";
   out << "characters:\n";
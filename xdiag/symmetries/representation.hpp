@@ -45,6 +45,11 @@ Representation trivial_representation(PermutationGroup const &group);
 PermutationGroup allowed_subgroup(PermutationGroup const &group,
                                   Representation const &irrep);
 
+// Representation of the group extended by a global spin flip, where the
+// characters of the flipped symmetries are multiplied by parity (+1 or -1)
+Representation spinflip_representation(Representation const &irrep,
+                                       int64_t parity);
+
 Representation multiply(Representation const &r1, Representation const &r2);
 Representation operator*(Representation const &r1, Representation const &r2);
 
@@ -0,0 +1,64 @@
+#include "block_memory.hpp"
+
+#include <iomanip>
+#include <sstream>
+
+namespace xdiag {
+
+int64_t BlockMemory::total() const {
+  return states + norms + indices + lintables + group_action + fermi_tables +
+         mpi_buffers;
+}
+
+BlockMemory &BlockMemory::operator+=(BlockMemory const &rhs) {
+  states += rhs.states;
+  norms += rhs.norms;
+  indices += rhs.indices;
+  lintables += rhs.lintables;
+  group_action += rhs.group_action;
+  fermi_tables += rhs.fermi_tables;
+  mpi_buffers += rhs.mpi_buffers;
+  return *this;
+}
+
+BlockMemory operator+(BlockMemory const &a, BlockMemory const &b) {
+  BlockMemory c = a;
+  c += b;
+  return c;
+}
+
+static std::string format_bytes(int64_t bytes) {
+  const char *units[] = {"B", "KiB", "MiB", "GiB", "TiB"};
+  double value = (double)bytes;
+  int unit = 0;
+  while ((value >= 1024.) && (unit < 4)) {
+    value /= 1024.;
+    ++unit;
+  }
+  std::stringstream ss;
+  if (unit == 0) {
+    ss << bytes << " " << units[unit];
+  } else {
+    ss << std::fixed << std::setprecision(2) << value << " " << units[unit];
+  }
+  return ss.str();
+}
+
+std::ostream &operator<<(std::ostream &out, BlockMemory const &memory) {
+  out << "BlockMemory:\n";
+  out << "  states      : " << format_bytes(memory.states) << "\n";
+  out << "  norms       : " << format_bytes(memory.norms) << "\n";
+  out << "  indices     : " << format_bytes(memory.indices) << "\n";
+  out << "  lintables   : " << format_bytes(memory.lintables) << "\n";
+  out << "  group action: " << format_bytes(memory.group_action) << "\n";
+  out << "  fermi tables: " << format_bytes(memory.fermi_tables) << "\n";
+  out << "  mpi buffers : " << format_bytes(memory.mpi_buffers) << "\n";
+  out << "  total       : " << format_bytes(memory.total()) << "\n";
+  return out;
+}
+
+std::string to_string(BlockMemory const &memory) {
+  return to_string_generic(memory);
+}
+
+} // namespace xdiag
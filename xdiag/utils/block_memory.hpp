@@ -0,0 +1,31 @@
+#pragma once
+
+#include <ostream>
+#include <string>
+
+#include <xdiag/common.hpp>
+
+namespace xdiag {
+
+// Breakdown of the memory (in bytes) held by the basis of a block. Tables
+// which are shared between several blocks, e.g. blocks created by
+// spinhalf_blocks or read from the basis cache, are counted for every block.
+struct BlockMemory {
+  int64_t states = 0;       // stored basis states and representatives
+  int64_t norms = 0;        // norms of the symmetrized basis states
+  int64_t indices = 0;      // index and symmetry tables of representatives
+  int64_t lintables = 0;    // lookup tables for combinatorial indexing
+  int64_t group_action = 0; // lookup tables for the permutation group action
+  int64_t fermi_tables = 0; // fermi sign tables of the permutation group
+  int64_t mpi_buffers = 0;  // communication buffers of distributed blocks
+
+  int64_t total() const;
+  BlockMemory &operator+=(BlockMemory const &rhs);
+};
+
+BlockMemory operator+(BlockMemory const &a, BlockMemory const &b);
+
+std::ostream &operator<<(std::ostream &out, BlockMemory const &memory);
+std::string to_string(BlockMemory const &memory);
+
+} // namespace xdiag
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <xdiag/common.hpp>
+
+namespace xdiag {
+
+// Read-only array whose memory is either owned (moved in from a
+// std::vector) or borrowed from another owner, e.g. a memory mapped file.
+// Copies share the underlying memory, so copying is cheap and pointers
+// into the array stay valid.
+template <typename T> class SharedArray {
+public:
+  SharedArray() = default;
+  explicit SharedArray(std::vector<T> &&vec) {
+    auto owner = std::make_shared<std::vector<T>>(std::move(vec));
+    data_ = owner->data();
+    size_ = (int64_t)owner->size();
+    owner_ = owner;
+  }
+  SharedArray(std::shared_ptr<void const> owner, T const *data, int64_t size)
+      : owner_(owner), data_(data), size_(size) {}
+
+  inline T const &operator[](int64_t idx) const { return data_[idx]; }
+  inline T const *data() const { return data_; }
+  inline int64_t size() const { return size_; }
+  inline T const *begin() const { return data_; }
+  inline T const *end() const { return data_ + size_; }
+
+private:
+  std::shared_ptr<void const> owner_;
+  T const *data_ = nullptr;
+  int64_t size_ = 0;
+};
+
+} // namespace xdiag